@@ -0,0 +1,270 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "benchmark.h"
+#include "interpreter.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+EXPRESSIO_NAMESPACE_USING
+
+static void benchmarkCalibration(UInt iterations) {
+    volatile Float sink = 0;
+
+    measure(EXPRESSIO_BENCHMARK_CALIBRATION, iterations, [&]() {
+        Float value = sink;
+
+        for (UInt i = 1; i <= 64; i++)
+            value = value * 0.5 + 1.0 / i;
+
+        sink = value;
+    }, false);
+}
+static void benchmarkInterpreter(UInt iterations) {
+    Interpreter interpreter;
+
+    interpreter.run("a = 1.5");
+    interpreter.run("b = 2.5");
+    interpreter.run("c = 3.5");
+    interpreter.run("d = 4.5");
+
+    const std::string plain = "a * b + c / d - (a + b) ^ 2 % 7";
+    const std::string definition = "x = " + plain;
+
+    measure("parse/plain", iterations, [&]() {
+        interpreter.compile(plain);
+    });
+    measure("parse/definition", iterations, [&]() {
+        interpreter.compile(definition);
+    });
+    measure("run/plain", iterations, [&]() {
+        interpreter.run(plain);
+    });
+    measure("run/definition", iterations, [&]() {
+        interpreter.run(definition);
+    });
+
+    interpreter.setCacheBudget(0);
+
+    measure("run/plain/uncached", iterations, [&]() {
+        interpreter.run(plain);
+    });
+    measure("run/definition/uncached", iterations, [&]() {
+        interpreter.run(definition);
+    });
+
+    const std::string redefinition = "longvariablenameforheap = " + plain;
+
+    countAllocations("run/plain/uncached", iterations / 100, [&]() {
+        interpreter.run(plain);
+    });
+    countAllocations("run/definition/uncached", iterations / 100, [&]() {
+        interpreter.run(definition);
+    });
+
+    interpreter.setCacheBudget(EXPRESSIO_CACHE_BUDGET);
+
+    countAllocations("run/plain", iterations / 100, [&]() {
+        interpreter.run(plain);
+    });
+    countAllocations("run/definition", iterations / 100, [&]() {
+        interpreter.run(definition);
+    });
+    countAllocations("run/definition/long-name", iterations / 100, [&]() {
+        interpreter.run(redefinition);
+    });
+
+    const std::string repeated = "(a + b) * (a + b) / (a + b - c) + (a + b) * (a + b) ^ 2";
+
+    CompiledExpression tree = interpreter.compile(repeated);
+
+    interpreter.setSubexpressionSharing(true);
+    CompiledExpression dag = interpreter.compile(repeated);
+    interpreter.setSubexpressionSharing(false);
+
+    const VariableTable & variables = interpreter.getVariableTable();
+
+    measure("evaluate/repeated", iterations, [&]() {
+        tree.evaluate(variables);
+    });
+    measure("evaluate/repeated/shared", iterations, [&]() {
+        dag.evaluate(variables);
+    });
+
+    std::printf("%-40s %12llu nodes\n", "shared/deduplicated",
+        (unsigned long long)dag.getSharedNodeCount());
+
+    interpreter.setNativeThreshold(0);
+    CompiledExpression virtualMachine = interpreter.compile(repeated);
+    interpreter.setNativeThreshold(1);
+    CompiledExpression native = interpreter.compile(repeated);
+    interpreter.setNativeThreshold(EXPRESSIO_NATIVE_THRESHOLD);
+
+    measure("evaluate/virtual-machine", iterations, [&]() {
+        virtualMachine.evaluate(variables);
+    });
+    native.evaluate(variables);
+
+    measure(native.isNative() ? "evaluate/native" : "evaluate/native (disabled)",
+        iterations, [&]() {
+        native.evaluate(variables);
+    });
+
+    const UInt rows = 1024;
+
+    CompiledExpression batch = interpreter.compile(plain);
+    CompiledExpression arithmetic = interpreter.compile("a * b + c / d - (a + b) * (c - d)");
+
+    std::vector<std::vector<Float> > columnData(batch.getParameterCount(),
+        std::vector<Float>(rows));
+    std::vector<const Float *> columns;
+    std::vector<Float> output(rows);
+
+    for (UInt i = 0; i < columnData.size(); i++) {
+        for (UInt j = 0; j < rows; j++)
+            columnData[i][j] = 1.0 + (Float)((i + j) % 17);
+
+        columns.push_back(columnData[i].data());
+    }
+
+    const char * instructionSets[] = { "scalar", "sse2", "avx2" };
+
+    for (UInt i = Kernel::Scalar; i <= Kernel::detect(); i++) {
+        Kernel kernel((Kernel::InstructionSet)i);
+
+        measure(std::string("batch/1024/") + instructionSets[i], iterations / 100, [&]() {
+            batch.evaluate(columns.data(), rows, output.data(), kernel);
+        });
+        measure(std::string("batch/1024/arithmetic/") + instructionSets[i],
+            iterations / 100, [&]() {
+            arithmetic.evaluate(columns.data(), rows, output.data(), kernel);
+        });
+    }
+
+    countAllocations("batch/1024", iterations / 100, [&]() {
+        batch.evaluate(columns.data(), rows, output.data());
+    });
+
+    ThreadPool threadPool;
+
+    measure("batch/1024/parallel", iterations / 100, [&]() {
+        batch.evaluate(columns.data(), rows, output.data(), threadPool, rows / 8);
+    });
+}
+
+int main(int argc, char ** argv) {
+    if (argc > 1 && std::string(argv[1]) == "soak")
+        return (int)soak(argc > 2 ? std::strtoull(argv[2], EXPRESSIO_NULL, 10) : 10000000);
+
+    if (argc > 1 && std::string(argv[1]) == "differential")
+        return differential(argc > 2 ? std::strtoull(argv[2], EXPRESSIO_NULL, 10) : 100000) != 0;
+
+    std::string report, baseline, merge;
+    Float threshold = 25.0;
+    UInt repeat = 1, retry = 0;
+
+    for (Int i = 1; i < argc; i++) {
+        std::string argument(argv[i]);
+
+        if (argument == "--json" && i + 1 < argc)
+            report = argv[++i];
+        else if (argument == "--baseline" && i + 1 < argc)
+            baseline = argv[++i];
+        else if (argument == "--merge" && i + 1 < argc)
+            merge = argv[++i];
+        else if (argument == "--threshold" && i + 1 < argc)
+            threshold = std::strtod(argv[++i], EXPRESSIO_NULL);
+        else if (argument == "--repeat" && i + 1 < argc)
+            repeat = std::max(std::strtoull(argv[++i], EXPRESSIO_NULL, 10), 1ULL);
+        else if (argument == "--retry" && i + 1 < argc)
+            retry = std::strtoull(argv[++i], EXPRESSIO_NULL, 10);
+        else {
+            std::fprintf(stderr, "Usage: %s [--json file] [--baseline file] [--merge file] "
+                "[--threshold percent] [--repeat count] [--retry count] | soak [evaluations] "
+                "| differential [expressions]\n", argv[0]);
+
+            return 2;
+        }
+    }
+
+    std::vector<Measurement> stored;
+
+    if (!baseline.empty() && (!readReport(baseline, stored) || stored.empty())) {
+        std::fprintf(stderr, "Unable to read baseline %s; run `make baseline` first.\n",
+            baseline.c_str());
+
+        return 2;
+    }
+
+    const UInt iterations = 200000;
+
+    for (UInt pass = 1; ; pass++) {
+        if (pass > 1)
+            std::printf("pass %llu\n", (unsigned long long)pass);
+
+        benchmarkCalibration(iterations);
+        benchmarkInterpreter(iterations);
+        benchmarkExpressions(iterations / 100);
+        benchmarkSessions(iterations);
+        benchmarkQueue(iterations / 100);
+        benchmarkTree(iterations / 100);
+
+        if (pass >= repeat && (stored.empty() || pass >= repeat + retry
+            || countRegressions(stored, threshold) == 0))
+            break;
+    }
+
+    std::vector<Measurement> previous;
+
+    if (!merge.empty() && readReport(merge, previous))
+        mergeReport(previous);
+
+    if (!report.empty() && !writeReport(report)) {
+        std::fprintf(stderr, "Unable to write %s.\n", report.c_str());
+
+        return 2;
+    }
+
+    UInt regressions = 0;
+
+    if (!baseline.empty()) {
+        if (!compareReport(baseline, threshold, regressions)) {
+            std::fprintf(stderr, "Unable to read baseline %s; run `make baseline` first.\n",
+                baseline.c_str());
+
+            return 2;
+        }
+
+        if (regressions != 0)
+            return 1;
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef EXPRESSIO_BENCHMARK_H
+#define EXPRESSIO_BENCHMARK_H
+
+#include "global.h"
+#include "types.h"
+#include "allocation.h"
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#define EXPRESSIO_BENCHMARK_ROUNDS 5
+#define EXPRESSIO_BENCHMARK_NOISE_LIMIT 10
+#define EXPRESSIO_BENCHMARK_CALIBRATION "calibration"
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+typedef std::chrono::steady_clock Clock;
+
+struct Measurement {
+    std::string name;
+    Float nanoseconds;
+    std::vector<Float> samples;
+    Bool gated;
+
+    Measurement();
+    Measurement(const std::string &, Float, Bool = true);
+    ~Measurement();
+
+    Float getMedian() const;
+    Float getNoise() const;
+    Measurement & merge(const Measurement &);
+};
+
+void record(const std::string &, Float, Bool = true);
+const std::vector<Measurement> & getMeasurements();
+Bool writeReport(const std::string &);
+Bool readReport(const std::string &, std::vector<Measurement> &);
+void mergeReport(const std::vector<Measurement> &);
+UInt countRegressions(const std::vector<Measurement> &, Float);
+Bool compareReport(const std::string &, Float, UInt &);
+
+template<typename Function>
+void measure(const std::string & name, UInt iterations, Function function,
+    Bool gated = true) {
+    function();
+
+    const UInt rounds = EXPRESSIO_BENCHMARK_ROUNDS;
+    const UInt count = iterations / rounds != 0 ? iterations / rounds : 1;
+
+    Float best = 0;
+
+    for (UInt round = 0; round < rounds; round++) {
+        Clock::time_point begin = Clock::now();
+
+        for (UInt i = 0; i < count; i++)
+            function();
+
+        Clock::time_point end = Clock::now();
+
+        Float nanoseconds = std::chrono::duration<Float, std::nano>(end - begin).count() / count;
+
+        if (round == 0 || nanoseconds < best)
+            best = nanoseconds;
+    }
+
+    record(name, best, gated);
+}
+
+template<typename Function>
+void countAllocations(const std::string & name, UInt iterations, Function function) {
+    function();
+
+    UInt begin = AllocationCounter::getStatistics().allocations;
+
+    for (UInt i = 0; i < iterations; i++)
+        function();
+
+    UInt end = AllocationCounter::getStatistics().allocations;
+
+    std::printf("%-40s %12.1f allocations/op\n", name.c_str(), (Float)(end - begin) / iterations);
+}
+
+void benchmarkExpressions(UInt);
+void benchmarkSessions(UInt);
+void benchmarkQueue(UInt);
+void benchmarkTree(UInt);
+UInt soak(UInt);
+UInt differential(UInt);
+
+EXPRESSIO_NAMESPACE_END
+
+#endif
\ No newline at end of file
@@ -0,0 +1,211 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "benchmark.h"
+#include "interpreter.h"
+#include "kernel.h"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+static UInt random(UInt & seed) {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+
+    return seed;
+}
+static void generate(UInt & seed, UInt depth, std::string & source) {
+    const Character * variables[] = { "a", "b", "c", "d", "e" };
+    const Character * numbers[] = { "0", "1", "2", "0.5", "3", "7" };
+    const Character operators[] = { '+', '-', '*', '/', '^', '%' };
+
+    if (depth == 0 || random(seed) % 4 == 0) {
+        if (random(seed) % 2 == 0)
+            source += variables[random(seed) % (sizeof(variables) / sizeof(variables[0]))];
+        else
+            source += numbers[random(seed) % (sizeof(numbers) / sizeof(numbers[0]))];
+
+        return;
+    }
+
+    Bool parenthesized = random(seed) % 2 == 0;
+
+    if (parenthesized)
+        source += '(';
+
+    generate(seed, depth - 1, source);
+
+    source += ' ';
+    source += operators[random(seed) % sizeof(operators)];
+    source += ' ';
+
+    generate(seed, depth - 1, source);
+
+    if (parenthesized)
+        source += ')';
+}
+static Bool isEqual(const Expression & lhs, const Expression & rhs) {
+    if (lhs.error.type != rhs.error.type)
+        return false;
+
+    if (lhs.error.type != ErrorContent::None)
+        return lhs.error.position == rhs.error.position;
+
+    Float a = lhs.output.value, b = rhs.output.value;
+
+    return (std::isnan(a) && std::isnan(b)) || std::memcmp(&a, &b, sizeof(Float)) == 0;
+}
+static Expression evaluateBatch(const CompiledExpression & compiledExpression,
+    const VariableTable & variableTable, const Kernel & kernel, ThreadPool * threadPool) {
+    const UInt rows = 3;
+
+    std::vector<std::vector<Float> > columnData(compiledExpression.getParameterCount());
+    std::vector<const Float *> columns(columnData.size(), EXPRESSIO_NULL);
+    std::vector<Float> output(rows);
+
+    for (UInt i = 0; i < columnData.size(); i++) {
+        UInt slot;
+
+        if (variableTable.find(compiledExpression.getParameterName(i), slot)
+            && variableTable.isDefined(slot)) {
+            columnData[i].assign(rows, variableTable.getValue(slot));
+            columns[i] = columnData[i].data();
+        }
+    }
+
+    ErrorContent error = threadPool != EXPRESSIO_NULL ?
+        compiledExpression.evaluate(columns.data(), rows, output.data(), *threadPool, 1, kernel) :
+        compiledExpression.evaluate(columns.data(), rows, output.data(), kernel);
+
+    return Expression(Result("", error.type == ErrorContent::None ? output[rows - 1] : 0),
+        error);
+}
+static void print(const Character * name, const Expression & expression) {
+    if (expression.error.type == ErrorContent::None)
+        std::printf("    %-24s %.17g\n", name, expression.output.value);
+    else
+        std::printf("    %-24s error %d at %llu\n", name, (int)expression.error.type,
+            (unsigned long long)expression.error.position);
+}
+
+UInt differential(UInt expressions) {
+    const Character * names[] = { "virtual-machine", "native", "optimized", "shared",
+        "batch/scalar", "batch/sse2", "batch/avx2", "batch/parallel" };
+    const UInt backendCount = sizeof(names) / sizeof(names[0]);
+
+    Interpreter reference, virtualMachine, native, optimized, shared;
+    Interpreter * interpreters[] = { &reference, &virtualMachine, &native, &optimized, &shared };
+
+    for (UInt i = 0; i < sizeof(interpreters) / sizeof(interpreters[0]); i++) {
+        interpreters[i]->setCacheBudget(0);
+        interpreters[i]->setOptimization(false);
+        interpreters[i]->setNativeThreshold(0);
+
+        interpreters[i]->run("a = 1.5");
+        interpreters[i]->run("b = 0");
+        interpreters[i]->run("c = 0 - 2");
+        interpreters[i]->run("d = 3");
+    }
+
+    native.setNativeThreshold(1);
+    optimized.setOptimization(true);
+    shared.setOptimization(true);
+    shared.setSubexpressionSharing(true);
+
+    ThreadPool threadPool(4);
+
+    std::vector<UInt> mismatches(backendCount, 0);
+    std::string source;
+    UInt seed = 88172645463325252ULL;
+    UInt nativeCount = 0;
+    UInt failures = 0;
+
+    for (UInt i = 0; i < expressions; i++) {
+        source.clear();
+        generate(seed, 1 + i % 5, source);
+
+        CompiledExpression tree = reference.compile(source);
+        Expression expected = tree.evaluate(reference.getVariableTable(),
+            CompiledExpression::TreeWalker);
+        CompiledExpression nativeCode = native.compile(source);
+
+        Expression actual[backendCount];
+
+        actual[0] = virtualMachine.compile(source).evaluate(virtualMachine.getVariableTable());
+        actual[1] = nativeCode.evaluate(native.getVariableTable());
+        actual[2] = optimized.compile(source).evaluate(optimized.getVariableTable());
+        actual[3] = shared.compile(source).evaluate(shared.getVariableTable());
+
+        for (UInt j = 4; j < backendCount - 1; j++) {
+            if (j - 4 > (UInt)Kernel::detect())
+                actual[j] = expected;
+            else
+                actual[j] = evaluateBatch(tree, reference.getVariableTable(),
+                    Kernel((Kernel::InstructionSet)(j - 4)), EXPRESSIO_NULL);
+        }
+
+        actual[backendCount - 1] = evaluateBatch(tree, reference.getVariableTable(), Kernel(),
+            &threadPool);
+
+        if (nativeCode.isNative())
+            nativeCount++;
+
+        Bool failed = false;
+
+        for (UInt j = 0; j < backendCount; j++) {
+            if (!isEqual(expected, actual[j])) {
+                mismatches[j]++;
+                failed = true;
+            }
+        }
+
+        if (failed && failures++ < 10) {
+            std::printf("mismatch: %s\n", source.c_str());
+            print("tree-walker", expected);
+
+            for (UInt j = 0; j < backendCount; j++)
+                print(names[j], actual[j]);
+        }
+    }
+
+    std::printf("%-40s %12llu\n", "differential/expressions", (unsigned long long)expressions);
+    std::printf("%-40s %12llu\n", "differential/native-compiled", (unsigned long long)nativeCount);
+
+    for (UInt i = 0; i < backendCount; i++)
+        std::printf("%-40s %12llu mismatches\n", (std::string("differential/") + names[i]).c_str(),
+            (unsigned long long)mismatches[i]);
+
+    return failures;
+}
+
+EXPRESSIO_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,132 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "benchmark.h"
+#include "interpreter.h"
+#include <string>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+static const Character * leaves[] = { "a", "b", "c", "d", "2", "3.5", "7", "1.25" };
+
+static std::string generate(UInt operators, UInt depth, const std::string & mix) {
+    std::string source(leaves[0]);
+
+    for (UInt i = 1; i <= operators; i++) {
+        source += ' ';
+        source += mix[i % mix.length()];
+        source += ' ';
+
+        if (depth != 0 && i <= depth)
+            source += '(';
+
+        source += leaves[i % 8];
+    }
+
+    if (depth != 0)
+        source.append(depth < operators ? depth : operators, ')');
+
+    return source;
+}
+
+static void benchmarkExpression(const std::string & name, const std::string & source,
+    UInt iterations) {
+    Interpreter interpreter;
+
+    interpreter.run("a = 1.5");
+    interpreter.run("b = 2.5");
+    interpreter.run("c = 3.5");
+    interpreter.run("d = 4.5");
+
+    measure(name + "/compile", iterations, [&]() {
+        interpreter.compile(source);
+    });
+
+    const UInt rounds = EXPRESSIO_BENCHMARK_ROUNDS;
+    const UInt count = iterations / rounds + 1;
+
+    Float phases[3] = { 0, 0, 0 };
+
+    for (UInt round = 0; round < rounds; round++) {
+        interpreter.resetStatistics();
+
+        for (UInt i = 0; i < count; i++)
+            interpreter.compile(source);
+
+        const Interpreter::Statistics & statistics = interpreter.getStatistics();
+        const Float times[3] = {
+            (Float)statistics.tokenizeTime / count,
+            (Float)statistics.parseTime / count,
+            (Float)statistics.optimizeTime / count
+        };
+
+        for (UInt i = 0; i < 3; i++) {
+            if (round == 0 || times[i] < phases[i])
+                phases[i] = times[i];
+        }
+    }
+
+    record(name + "/tokenize", phases[0]);
+    record(name + "/parse", phases[1]);
+    record(name + "/optimize", phases[2]);
+
+    interpreter.setNativeThreshold(0);
+
+    CompiledExpression compiledExpression = interpreter.compile(source);
+    const VariableTable & variables = interpreter.getVariableTable();
+
+    measure(name + "/evaluate", iterations, [&]() {
+        compiledExpression.evaluate(variables);
+    });
+}
+
+void benchmarkExpressions(UInt iterations) {
+    const Character * mixes[][2] = {
+        { "additive", "+-" },
+        { "multiplicative", "*/" },
+        { "power", "^%" },
+        { "mixed", "+*-/%^" }
+    };
+    const UInt sizes[] = { 8, 64, 512, 4096 };
+    const UInt depths[] = { 16, 256, 4096 };
+
+    for (UInt i = 0; i < sizeof(mixes) / sizeof(mixes[0]); i++) {
+        for (UInt j = 0; j < sizeof(sizes) / sizeof(UInt); j++) {
+            benchmarkExpression(std::string("expression/") + mixes[i][0] + "/"
+                + std::to_string(sizes[j]), generate(sizes[j], 0, mixes[i][1]),
+                iterations * 8 / sizes[j] + 1);
+        }
+    }
+
+    for (UInt i = 0; i < sizeof(depths) / sizeof(UInt); i++) {
+        benchmarkExpression("expression/nested/" + std::to_string(depths[i]),
+            generate(depths[i], depths[i], mixes[3][1]), iterations * 8 / depths[i] + 1);
+    }
+}
+
+EXPRESSIO_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,171 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "benchmark.h"
+#include "queue.h"
+#include "ast.h"
+#include <string>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+template<typename T>
+class LinkedQueue {
+public:
+    struct Node {
+        T data;
+        Node * next;
+    };
+
+    LinkedQueue() : begin(EXPRESSIO_NULL), end(EXPRESSIO_NULL) {}
+    ~LinkedQueue() {
+        while (remove());
+    }
+
+    Node * getBegin() const {
+        return begin;
+    }
+    Bool isEmpty() const {
+        return begin == EXPRESSIO_NULL;
+    }
+
+    void insert(const T & element) {
+        Node * node = new Node;
+
+        node->data = element;
+        node->next = EXPRESSIO_NULL;
+
+        if (end != EXPRESSIO_NULL)
+            end->next = node;
+        else
+            begin = node;
+
+        end = node;
+    }
+    Bool remove() {
+        if (begin == EXPRESSIO_NULL)
+            return false;
+
+        Node * node = begin;
+        begin = node->next;
+
+        if (begin == EXPRESSIO_NULL)
+            end = EXPRESSIO_NULL;
+
+        delete node;
+
+        return true;
+    }
+
+private:
+    Node * begin, *end;
+};
+
+static const UInt elementCount = 1024;
+
+template<typename Sequence>
+static UInt fill(Sequence & sequence) {
+    for (UInt i = 0; i < elementCount; i++)
+        sequence.insert((SymbolPointer)(i + 1));
+
+    return elementCount;
+}
+
+void benchmarkQueue(UInt iterations) {
+    volatile UInt sink = 0;
+
+    measure("queue/insert/linked", iterations, [&]() {
+        LinkedQueue<SymbolPointer> queue;
+        sink = sink + fill(queue);
+    }, false);
+    measure("queue/insert/contiguous", iterations, [&]() {
+        Queue<SymbolPointer> queue;
+        sink = sink + fill(queue);
+    });
+    measure("queue/insert/reserved", iterations, [&]() {
+        Queue<SymbolPointer> queue;
+        queue.reserve(elementCount);
+        sink = sink + fill(queue);
+    });
+
+    LinkedQueue<SymbolPointer> linked;
+    Queue<SymbolPointer> contiguous;
+
+    fill(linked);
+    fill(contiguous);
+
+    const Queue<SymbolPointer> & view = contiguous;
+
+    measure("queue/iterate/linked", iterations, [&]() {
+        UInt sum = 0;
+
+        for (LinkedQueue<SymbolPointer>::Node * node = linked.getBegin();
+            node != EXPRESSIO_NULL; node = node->next)
+            sum += (UInt)node->data;
+
+        sink = sink + sum;
+    }, false);
+    measure("queue/iterate/contiguous", iterations, [&]() {
+        UInt sum = 0;
+
+        for (Queue<SymbolPointer>::ConstIterator it = view.getBegin();
+            it != view.getEnd(); it++)
+            sum += (UInt)*it;
+
+        sink = sink + sum;
+    });
+
+    measure("queue/fifo/linked", iterations, [&]() {
+        LinkedQueue<SymbolPointer> queue;
+        queue.insert((SymbolPointer)1);
+
+        for (UInt i = 1; i < elementCount; i++) {
+            queue.insert((SymbolPointer)(i + 1));
+
+            if (i % 2 == 0)
+                queue.remove();
+        }
+
+        while (queue.remove())
+            sink = sink + 1;
+    }, false);
+    measure("queue/fifo/contiguous", iterations, [&]() {
+        Queue<SymbolPointer> queue;
+        queue.insert((SymbolPointer)1);
+
+        for (UInt i = 1; i < elementCount; i++) {
+            queue.insert((SymbolPointer)(i + 1));
+
+            if (i % 2 == 0)
+                queue.remove();
+        }
+
+        while (queue.remove())
+            sink = sink + 1;
+    });
+}
+
+EXPRESSIO_NAMESPACE_END
\ No newline at end of file
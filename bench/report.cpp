@@ -0,0 +1,276 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "benchmark.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+static std::vector<Measurement> measurements;
+
+Measurement::Measurement() : nanoseconds(0), gated(true) {}
+Measurement::Measurement(const std::string & name, Float nanoseconds, Bool gated)
+    : name(name), nanoseconds(nanoseconds), samples(1, nanoseconds), gated(gated) {}
+Measurement::~Measurement() {}
+
+Float Measurement::getMedian() const {
+    if (samples.empty())
+        return nanoseconds;
+
+    std::vector<Float> sorted(samples);
+
+    std::sort(sorted.begin(), sorted.end());
+
+    return (sorted[(sorted.size() - 1) / 2] + sorted[sorted.size() / 2]) / 2;
+}
+Float Measurement::getNoise() const {
+    Float median = getMedian();
+
+    if (median <= 0)
+        return 0;
+
+    Measurement deviation;
+
+    for (UInt i = 0; i < samples.size(); i++)
+        deviation.samples.push_back(std::abs(samples[i] - median));
+
+    return 100.0 * deviation.getMedian() / median;
+}
+Measurement & Measurement::merge(const Measurement & measurement) {
+    nanoseconds = std::min(nanoseconds, measurement.nanoseconds);
+    samples.insert(samples.end(), measurement.samples.begin(), measurement.samples.end());
+
+    return *this;
+}
+
+static UInt find(const std::vector<Measurement> & report, const std::string & name) {
+    UInt i = 0;
+
+    while (i < report.size() && report[i].name != name)
+        i++;
+
+    return i;
+}
+
+void record(const std::string & name, Float nanoseconds, Bool gated) {
+    Measurement measurement(name, nanoseconds, gated);
+    UInt i = find(measurements, name);
+
+    if (i == measurements.size())
+        measurements.push_back(measurement);
+    else {
+        measurements[i].nanoseconds = std::min(measurements[i].nanoseconds, nanoseconds);
+        measurements[i].samples.back() = std::min(measurements[i].samples.back(), nanoseconds);
+    }
+
+    std::printf("%-40s %12.1f ns/op\n", name.c_str(), nanoseconds);
+    std::fflush(stdout);
+}
+void mergeReport(const std::vector<Measurement> & report) {
+    for (UInt i = 0; i < report.size(); i++) {
+        UInt j = find(measurements, report[i].name);
+
+        if (j == measurements.size())
+            measurements.push_back(report[i]);
+        else
+            measurements[j].merge(report[i]);
+    }
+}
+const std::vector<Measurement> & getMeasurements() {
+    return measurements;
+}
+Bool writeReport(const std::string & filename) {
+    std::ofstream file(filename.c_str());
+
+    if (!file.is_open())
+        return false;
+
+    Character number[64];
+
+    file << "{\n    \"benchmarks\": [\n";
+
+    for (UInt i = 0; i < measurements.size(); i++) {
+        const Measurement & measurement = measurements[i];
+
+        std::snprintf(number, sizeof(number), "%.3f", measurement.nanoseconds);
+        file << "        { \"name\": \"" << measurement.name << "\", \"ns_per_op\": " << number;
+
+        std::snprintf(number, sizeof(number), "%.3f", measurement.getMedian());
+        file << ", \"median\": " << number;
+
+        std::snprintf(number, sizeof(number), "%.1f", measurement.getNoise());
+        file << ", \"noise\": " << number << ", \"samples\": [";
+
+        for (UInt j = 0; j < measurement.samples.size(); j++) {
+            std::snprintf(number, sizeof(number), "%.3f", measurement.samples[j]);
+            file << (j != 0 ? ", " : "") << number;
+        }
+
+        file << "]" << (measurement.gated ? "" : ", \"gated\": false") << " }"
+            << (i + 1 < measurements.size() ? ",\n" : "\n");
+    }
+
+    file << "    ]\n}\n";
+
+    return file.good();
+}
+Bool readReport(const std::string & filename, std::vector<Measurement> & report) {
+    std::ifstream file(filename.c_str());
+
+    if (!file.is_open())
+        return false;
+
+    std::string line;
+
+    while (std::getline(file, line)) {
+        std::string::size_type name = line.find("\"name\": \"");
+        std::string::size_type value = line.find("\"ns_per_op\": ");
+
+        if (name == std::string::npos || value == std::string::npos)
+            continue;
+
+        name += std::strlen("\"name\": \"");
+
+        std::string::size_type end = line.find('"', name);
+
+        if (end == std::string::npos)
+            continue;
+
+        Measurement measurement(line.substr(name, end - name),
+            std::strtod(line.c_str() + value + std::strlen("\"ns_per_op\": "), EXPRESSIO_NULL),
+            line.find("\"gated\": false") == std::string::npos);
+
+        std::string::size_type samples = line.find("\"samples\": [");
+
+        if (samples != std::string::npos) {
+            const Character * cursor = line.c_str() + samples + std::strlen("\"samples\": [");
+            Character * next;
+
+            measurement.samples.clear();
+
+            for (;;) {
+                Float sample = std::strtod(cursor, &next);
+
+                if (next == cursor)
+                    break;
+
+                measurement.samples.push_back(sample);
+                cursor = next;
+
+                while (*cursor == ',' || *cursor == ' ')
+                    cursor++;
+            }
+        }
+
+        report.push_back(measurement);
+    }
+
+    return true;
+}
+static UInt compare(const std::vector<Measurement> & baseline, Float threshold, Bool print) {
+    std::vector<Float> ratios(measurements.size(), 0), noise(measurements.size(), 0);
+    std::vector<Float> gatedRatios;
+    Float calibration = 1;
+
+    for (UInt i = 0; i < measurements.size(); i++) {
+        UInt j = find(baseline, measurements[i].name);
+
+        if (j == baseline.size() || baseline[j].getMedian() <= 0)
+            continue;
+
+        ratios[i] = measurements[i].nanoseconds / baseline[j].getMedian();
+        noise[i] = std::min(baseline[j].getNoise(), (Float)EXPRESSIO_BENCHMARK_NOISE_LIMIT);
+
+        if (measurements[i].name == EXPRESSIO_BENCHMARK_CALIBRATION)
+            calibration = ratios[i];
+        else if (measurements[i].gated)
+            gatedRatios.push_back(ratios[i]);
+    }
+
+    Float drift = 1;
+
+    if (!gatedRatios.empty()) {
+        std::sort(gatedRatios.begin(), gatedRatios.end());
+        drift = gatedRatios[gatedRatios.size() / 2];
+    }
+
+    UInt regressions = 0;
+
+    if (print)
+        std::printf("\n%-40s %12s %9s %11s %8s\n", "benchmark", "current", "change",
+            "calibrated", "noise");
+
+    for (UInt i = 0; i < measurements.size(); i++) {
+        if (ratios[i] == 0)
+            continue;
+
+        Float change = 100.0 * (ratios[i] - 1);
+        Float calibrated = 100.0 * (ratios[i] / std::max(calibration, 1.0) - 1);
+        Bool regressed = measurements[i].gated && calibrated > threshold + noise[i];
+
+        if (print)
+            std::printf("%-40s %12.1f %+8.1f%% %+10.1f%% %7.1f%%%s\n",
+                measurements[i].name.c_str(), measurements[i].nanoseconds, change, calibrated,
+                noise[i], regressed ? " REGRESSION" : measurements[i].gated ? "" : " (reference)");
+
+        if (regressed)
+            regressions++;
+    }
+
+    if (print)
+        std::printf("calibration %+.1f%%, suite median change %+.1f%%, %llu regression(s) above "
+            "%.1f%% plus noise\n", 100.0 * (calibration - 1), 100.0 * (drift - 1),
+            (unsigned long long)regressions, threshold);
+
+    return regressions;
+}
+
+UInt countRegressions(const std::vector<Measurement> & baseline, Float threshold) {
+    return compare(baseline, threshold, false);
+}
+Bool compareReport(const std::string & filename, Float threshold, UInt & regressions) {
+    std::vector<Measurement> baseline;
+
+    regressions = 0;
+
+    if (!readReport(filename, baseline) || baseline.empty())
+        return false;
+
+    regressions = compare(baseline, threshold, true);
+
+    return true;
+}
+
+EXPRESSIO_NAMESPACE_END
\ No newline at end of file
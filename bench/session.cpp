@@ -0,0 +1,94 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "benchmark.h"
+#include "interpreter.h"
+#include <string>
+#include <vector>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+static std::string variableName(UInt index) {
+    std::string name("v");
+
+    do {
+        name += (Character)('a' + index % 26);
+        index /= 26;
+    } while (index != 0);
+
+    return name;
+}
+
+void benchmarkSessions(UInt iterations) {
+    const UInt counts[] = { 1, 100, 10000, 100000 };
+
+    for (UInt i = 0; i < sizeof(counts) / sizeof(UInt); i++) {
+        const UInt count = counts[i];
+        const std::string prefix = "session/" + std::to_string(count);
+
+        Interpreter interpreter;
+
+        std::vector<std::string> names, definitions;
+
+        for (UInt j = 0; j < count; j++) {
+            names.push_back(variableName(j));
+            definitions.push_back(names[j] + " = " + std::to_string(j + 1));
+
+            interpreter.run(definitions[j]);
+        }
+
+        UInt k = 0;
+
+        measure(prefix + "/define", iterations / 10, [&]() {
+            interpreter.run(definitions[k]);
+            k = (k + 7919) % count;
+        });
+
+        std::string source(names[count - 1]);
+
+        for (UInt j = 1; j < 8; j++)
+            source += " * " + names[(count - 1) * j / 8];
+
+        measure(prefix + "/run", iterations, [&]() {
+            interpreter.run(source);
+        });
+        measure(prefix + "/compile", iterations / 10, [&]() {
+            interpreter.compile(source);
+        });
+
+        const VariableTable & variables = interpreter.getVariableTable();
+        UInt slot = 0;
+
+        measure(prefix + "/lookup", iterations, [&]() {
+            variables.find(names[k], slot);
+            k = (k + 7919) % count;
+        });
+    }
+}
+
+EXPRESSIO_NAMESPACE_END
\ No newline at end of file
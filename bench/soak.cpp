@@ -0,0 +1,135 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "benchmark.h"
+#include "interpreter.h"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+static UInt residentSize() {
+#ifdef __linux__
+    FILE * file = std::fopen("/proc/self/statm", "r");
+    unsigned long long pages = 0, resident = 0;
+
+    if (file == EXPRESSIO_NULL)
+        return 0;
+
+    if (std::fscanf(file, "%llu %llu", &pages, &resident) != 2)
+        resident = 0;
+
+    std::fclose(file);
+
+    return resident * sysconf(_SC_PAGESIZE);
+#else
+    return 0;
+#endif
+}
+
+static void exercise(Interpreter & interpreter, UInt iteration, std::string & source) {
+    Character number[32];
+
+    switch (iteration % 8) {
+    case 0:
+        interpreter.run("a * b + c / d - (a + b) ^ 2 % 7");
+        break;
+    case 1:
+        interpreter.run("x = a * x % 13 + 1");
+        break;
+    case 2:
+        std::snprintf(number, sizeof(number), "%llu", (unsigned long long)iteration);
+
+        source = "a * ";
+        source += number;
+        source += " + b";
+
+        interpreter.run(source);
+        break;
+    case 3:
+        interpreter.run(iteration % 3 == 0 ? "a $ b" : iteration % 3 == 1 ? "(a + " : "a / (b - b)");
+        break;
+    case 4:
+        interpreter.run("undefined + 1");
+        break;
+    case 5:
+        source.assign(64, '(');
+        source += "a";
+        source.append(64, ')');
+
+        interpreter.evaluate(source.data(), source.length());
+        break;
+    case 6:
+        interpreter.compile("y = (a + b) * (a + b) - x").evaluate(interpreter.getVariableTable());
+        break;
+    default:
+        interpreter.run("b = 2.5");
+    }
+}
+
+UInt soak(UInt evaluations) {
+    std::string source;
+    UInt checkpoint = evaluations / 10 > 0 ? evaluations / 10 : 1;
+    UInt warmSize = 0;
+
+    std::printf("%-32s %12s\n", "soak/evaluations", "rss (KB)");
+
+    for (UInt i = 0; i < evaluations;) {
+        Interpreter interpreter;
+        interpreter.setReactive(i / checkpoint % 2 == 1);
+
+        interpreter.run("a = 1.5");
+        interpreter.run("b = 2.5");
+        interpreter.run("c = 3.5");
+        interpreter.run("d = 4.5");
+        interpreter.run("x = 1");
+
+        for (UInt end = i + checkpoint < evaluations ? i + checkpoint : evaluations; i < end; i++)
+            exercise(interpreter, i, source);
+
+        UInt size = residentSize();
+
+        if (i <= 2 * checkpoint)
+            warmSize = size;
+
+        std::printf("%-32llu %12llu\n", (unsigned long long)i, (unsigned long long)size / 1024);
+    }
+
+    Int growth = (Int)residentSize() - (Int)warmSize;
+
+    std::printf("%-32s %12lld\n", "soak/growth", (long long)growth / 1024);
+
+    return growth > (Int)(warmSize / 10) ? 1 : 0;
+}
+
+EXPRESSIO_NAMESPACE_END
\ No newline at end of file
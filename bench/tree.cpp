@@ -0,0 +1,74 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "benchmark.h"
+#include "tree.h"
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+static const UInt keyCount = 1024;
+
+static Int key(UInt index) {
+    return (Int)((index * 2654435761ULL) % 1000003);
+}
+
+void benchmarkTree(UInt iterations) {
+    volatile UInt sink = 0;
+
+    measure("tree/insert", iterations, [&]() {
+        Tree<Int> tree;
+
+        for (UInt i = 0; i < keyCount; i++)
+            tree.insert(key(i));
+
+        sink = sink + tree.getSize();
+    });
+
+    Tree<Int> tree;
+
+    for (UInt i = 0; i < keyCount; i++)
+        tree.insert(key(i));
+
+    measure("tree/search", iterations, [&]() {
+        UInt found = 0;
+
+        for (UInt i = 0; i < keyCount; i++)
+            found += tree.search(key(i)) != EXPRESSIO_NULL;
+
+        sink = sink + found;
+    });
+    measure("tree/copy", iterations, [&]() {
+        Tree<Int> copy(tree);
+        sink = sink + copy.getSize();
+    });
+    measure("tree/height", iterations, [&]() {
+        sink = sink + tree.height();
+    });
+}
+
+EXPRESSIO_NAMESPACE_END
\ No newline at end of file
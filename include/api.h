@@ -0,0 +1,97 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef EXPRESSIO_API_H
+#define EXPRESSIO_API_H
+
+#include <stddef.h>
+
+#if defined(_WIN32) && defined(EXPRESSIO_SHARED)
+#ifdef EXPRESSIO_EXPORTS
+#define EXPRESSIO_API __declspec(dllexport)
+#else
+#define EXPRESSIO_API __declspec(dllimport)
+#endif
+#elif defined(__GNUC__)
+#define EXPRESSIO_API __attribute__((visibility("default")))
+#else
+#define EXPRESSIO_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct expressio_interpreter expressio_interpreter;
+typedef struct expressio_expression expressio_expression;
+
+typedef enum expressio_status {
+    EXPRESSIO_OK = 0,
+    EXPRESSIO_UNKNOWN_SYMBOL,
+    EXPRESSIO_INVALID_EXPRESSION,
+    EXPRESSIO_UNDEFINED_VARIABLE,
+    EXPRESSIO_DIVISION_BY_ZERO,
+    EXPRESSIO_DEPTH_LIMIT_EXCEEDED,
+    EXPRESSIO_INVALID_ARGUMENT,
+    EXPRESSIO_OUT_OF_MEMORY
+} expressio_status;
+
+EXPRESSIO_API const char * expressio_version(void);
+EXPRESSIO_API const char * expressio_status_string(expressio_status);
+
+EXPRESSIO_API expressio_interpreter * expressio_interpreter_create(void);
+EXPRESSIO_API void expressio_interpreter_destroy(expressio_interpreter *);
+EXPRESSIO_API expressio_status expressio_interpreter_set_decimal_separator(
+    expressio_interpreter *, char);
+EXPRESSIO_API expressio_status expressio_interpreter_set_depth_limit(
+    expressio_interpreter *, size_t);
+
+EXPRESSIO_API expressio_status expressio_bind(expressio_interpreter *, const char *, double);
+EXPRESSIO_API expressio_status expressio_lookup(const expressio_interpreter *, const char *,
+    double *);
+EXPRESSIO_API expressio_status expressio_run(expressio_interpreter *, const char *, size_t,
+    double *, size_t *);
+
+EXPRESSIO_API expressio_status expressio_compile(expressio_interpreter *, const char *, size_t,
+    expressio_expression **, size_t *);
+EXPRESSIO_API void expressio_expression_destroy(expressio_expression *);
+EXPRESSIO_API size_t expressio_expression_parameter_count(const expressio_expression *);
+EXPRESSIO_API const char * expressio_expression_parameter_name(const expressio_expression *,
+    size_t);
+EXPRESSIO_API expressio_status expressio_evaluate(const expressio_expression *, double *,
+    size_t *);
+EXPRESSIO_API expressio_status expressio_evaluate_values(const expressio_expression *,
+    const double *, double *, size_t *);
+EXPRESSIO_API expressio_status expressio_evaluate_batch(const expressio_expression *,
+    const double * const *, size_t, double *, size_t *);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
\ No newline at end of file
@@ -0,0 +1,128 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef EXPRESSIO_BYTECODE_H
+#define EXPRESSIO_BYTECODE_H
+
+#include "global.h"
+#include "types.h"
+#include "ast.h"
+#include "syntax.h"
+#include <string>
+#include <vector>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+class Kernel;
+
+class Bytecode {
+public:
+    enum OpCode {
+        Add = 0,
+        Subtract,
+        Multiply,
+        Divide,
+        Power,
+        Modulo
+    };
+
+    struct Operand {
+        enum Kind {
+            Register = 0,
+            Constant,
+            Variable
+        };
+
+        Kind kind;
+        UInt index;
+
+        Operand();
+        Operand(Kind, UInt);
+        ~Operand();
+    };
+
+    struct Instruction {
+        OpCode code;
+        UInt target;
+        Operand lhs, rhs;
+        UInt position;
+
+        Instruction();
+        Instruction(OpCode, UInt, const Operand &, const Operand &, UInt);
+        ~Instruction();
+    };
+
+    struct Parameter {
+        std::string name;
+        UInt position;
+        UInt checkpoint;
+
+        Parameter();
+        Parameter(const std::string &, UInt, UInt);
+        ~Parameter();
+    };
+
+    Bytecode();
+    ~Bytecode();
+
+    Bytecode & lower(const SyntaxTree &);
+    Bytecode & clear();
+    Bool run(const Float *, Float *, Float &, UInt &) const;
+    Bool run(const Float *, Float *, UInt, Float &, UInt &) const;
+    Bool run(const Float * const *, UInt, Float *, const Kernel &, UInt &) const;
+    Bool run(const Float * const *, UInt, Float *, const Kernel &, UInt, UInt &) const;
+
+    UInt getRegisterCount() const;
+    UInt getInstructionCount() const;
+    UInt getConstantCount() const;
+    UInt getParameterCount() const;
+    const Instruction & getInstruction(UInt) const;
+    Float getConstant(UInt) const;
+    const Parameter & getParameter(UInt) const;
+    const Operand & getResult() const;
+    UInt getMemoryUsage() const;
+    Bool findParameter(const std::string &, UInt &) const;
+
+private:
+    std::vector<Instruction> instructions;
+    std::vector<Float> constants;
+    std::vector<Parameter> parameters;
+    Operand result;
+    UInt registerCount;
+
+    std::vector<Operand> operands;
+    std::vector<UInt> names;
+    std::vector<UInt> lastUse;
+    std::vector<UInt> physical;
+    std::vector<UInt> available;
+
+    void allocate();
+};
+
+EXPRESSIO_NAMESPACE_END
+
+#endif
\ No newline at end of file
@@ -0,0 +1,204 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef EXPRESSIO_CACHE_H
+#define EXPRESSIO_CACHE_H
+
+#include "global.h"
+#include "types.h"
+#include <list>
+#include <string>
+#include <unordered_map>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+template<typename T>
+class LRUCache {
+public:
+    struct Statistics {
+        UInt hits;
+        UInt misses;
+        UInt evictions;
+        UInt entries;
+        UInt bytesUsed;
+        UInt budget;
+
+        Statistics();
+        ~Statistics();
+    };
+
+    LRUCache(UInt = EXPRESSIO_CACHE_BUDGET);
+    ~LRUCache();
+
+    UInt getSize() const;
+    UInt getBudget() const;
+    Statistics getStatistics() const;
+    Bool isEmpty() const;
+
+    T * find(const std::string &);
+    LRUCache & insert(const std::string &, const T &, UInt);
+    LRUCache & setBudget(UInt);
+    LRUCache & clear();
+
+private:
+    struct Entry {
+        std::string key;
+        T value;
+        UInt size;
+
+        Entry();
+        Entry(const std::string &, const T &, UInt);
+        ~Entry();
+    };
+
+    typedef typename std::list<Entry>::iterator EntryIterator;
+
+    std::list<Entry> entries;
+    std::unordered_map<std::string, EntryIterator> index;
+    Statistics statistics;
+
+    void evict(UInt);
+};
+
+template<typename T>
+LRUCache<T>::Statistics::Statistics() : hits(0), misses(0), evictions(0),
+    entries(0), bytesUsed(0), budget(0) {}
+template<typename T>
+LRUCache<T>::Statistics::~Statistics() {}
+
+template<typename T>
+LRUCache<T>::Entry::Entry() : size(0) {}
+template<typename T>
+LRUCache<T>::Entry::Entry(const std::string & key, const T & value, UInt size)
+    : key(key), value(value), size(size) {}
+template<typename T>
+LRUCache<T>::Entry::~Entry() {}
+
+template<typename T>
+LRUCache<T>::LRUCache(UInt budget) {
+    statistics.budget = budget;
+}
+template<typename T>
+LRUCache<T>::~LRUCache() {}
+
+template<typename T>
+UInt LRUCache<T>::getSize() const {
+    return entries.size();
+}
+template<typename T>
+UInt LRUCache<T>::getBudget() const {
+    return statistics.budget;
+}
+template<typename T>
+typename LRUCache<T>::Statistics LRUCache<T>::getStatistics() const {
+    return statistics;
+}
+template<typename T>
+Bool LRUCache<T>::isEmpty() const {
+    return entries.empty();
+}
+
+template<typename T>
+T * LRUCache<T>::find(const std::string & key) {
+    typename std::unordered_map<std::string, EntryIterator>::iterator it = index.find(key);
+
+    if (it == index.end()) {
+        statistics.misses++;
+
+        return EXPRESSIO_NULL;
+    }
+
+    statistics.hits++;
+    entries.splice(entries.begin(), entries, it->second);
+
+    return &it->second->value;
+}
+template<typename T>
+LRUCache<T> & LRUCache<T>::insert(const std::string & key, const T & value, UInt size) {
+    size += 2 * key.size() + sizeof(Entry)
+        + sizeof(typename std::unordered_map<std::string, EntryIterator>::value_type);
+
+    typename std::unordered_map<std::string, EntryIterator>::iterator it = index.find(key);
+
+    if (it != index.end()) {
+        statistics.bytesUsed -= it->second->size;
+        entries.erase(it->second);
+        index.erase(it);
+    }
+
+    if (size > statistics.budget) {
+        statistics.entries = entries.size();
+
+        return *this;
+    }
+
+    evict(statistics.budget - size);
+
+    entries.push_front(Entry(key, value, size));
+    index.insert(std::make_pair(key, entries.begin()));
+
+    statistics.bytesUsed += size;
+    statistics.entries = entries.size();
+
+    return *this;
+}
+template<typename T>
+LRUCache<T> & LRUCache<T>::setBudget(UInt budget) {
+    statistics.budget = budget;
+    evict(budget);
+
+    return *this;
+}
+template<typename T>
+LRUCache<T> & LRUCache<T>::clear() {
+    entries.clear();
+    index.clear();
+
+    statistics.entries = 0;
+    statistics.bytesUsed = 0;
+
+    return *this;
+}
+
+template<typename T>
+void LRUCache<T>::evict(UInt budget) {
+    while (!entries.empty() && statistics.bytesUsed > budget) {
+        Entry & entry = entries.back();
+
+        statistics.bytesUsed -= entry.size;
+        statistics.evictions++;
+
+        index.erase(entry.key);
+        entries.pop_back();
+    }
+
+    statistics.entries = entries.size();
+}
+
+EXPRESSIO_NAMESPACE_END
+
+#endif
\ No newline at end of file
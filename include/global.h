@@ -1,44 +1,59 @@
-// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
-//
-// Redistribution and use in source and binary forms, with or without
-// modification, are permitted provided that the following conditions are met:
-//
-// * Redistributions of source code must retain the above copyright notice, this
-//   list of conditions and the following disclaimer.
-//
-// * Redistributions in binary form must reproduce the above copyright notice,
-//   this list of conditions and the following disclaimer in the documentation
-//   and/or other materials provided with the distribution.
-//
-// * Neither the name of the copyright holder nor the names of its
-//   contributors may be used to endorse or promote products derived from
-//   this software without specific prior written permission.
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
-// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
-// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
-// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
-// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-#ifndef EXPRESSIO_GLOBAL_H
-#define EXPRESSIO_GLOBAL_H
-
-#define EXPRESSIO_NAME "Expressio"
-#define EXPRESSIO_VERSION "1.0.0.0"
-#define EXPRESSIO_AUTHOR "Danilo Peixoto"
-#define EXPRESSIO_COPYRIGHT "Copyright (c) 2017, Danilo Peixoto. All rights reserved."
-#define EXPRESSIO_LICENSE "BSD-3-Clause License"
-
-#define EXPRESSIO_NAMESPACE_BEGIN namespace expressio {
-#define EXPRESSIO_NAMESPACE_END };
-#define EXPRESSIO_NAMESPACE_USING using namespace expressio;
-
-#define EXPRESSIO_NULL nullptr
-#define EXPRESSIO_MAX_OPTION_LENGTH 5
-
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef EXPRESSIO_GLOBAL_H
+#define EXPRESSIO_GLOBAL_H
+
+#define EXPRESSIO_NAME "Expressio"
+#define EXPRESSIO_VERSION "1.0.0.0"
+#define EXPRESSIO_AUTHOR "Danilo Peixoto"
+#define EXPRESSIO_COPYRIGHT "Copyright (c) 2017, Danilo Peixoto. All rights reserved."
+#define EXPRESSIO_LICENSE "BSD-3-Clause License"
+
+#define EXPRESSIO_NAMESPACE_BEGIN namespace expressio {
+#define EXPRESSIO_NAMESPACE_END };
+#define EXPRESSIO_NAMESPACE_USING using namespace expressio;
+
+#define EXPRESSIO_NULL nullptr
+#define EXPRESSIO_MAX_OPTION_LENGTH 5
+#define EXPRESSIO_REGISTER_FILE_SIZE 64
+#define EXPRESSIO_MAX_NUMBER_LENGTH 63
+#define EXPRESSIO_MAX_FORMAT_LENGTH 320
+#define EXPRESSIO_BATCH_TILE_SIZE 512
+#define EXPRESSIO_BATCH_CHUNK_SIZE 16384
+#define EXPRESSIO_NATIVE_THRESHOLD 1000
+#define EXPRESSIO_CACHE_BUDGET 4194304
+#define EXPRESSIO_STREAM_BUFFER_SIZE 65536
+#define EXPRESSIO_PARALLEL_BUFFER_SIZE 1048576
+#define EXPRESSIO_PARALLEL_BLOCK_SIZE 65536
+#define EXPRESSIO_PARALLEL_CHUNK_SIZE 1024
+#define EXPRESSIO_LATENCY_BUCKET_COUNT 512
+#define EXPRESSIO_STATISTICS_SAMPLE_RATE 16
+#define EXPRESSIO_STATISTICS_SAMPLE_MINIMUM 32
+#define EXPRESSIO_TRACE_BUFFER_SIZE 1048576
+
 #endif
\ No newline at end of file
@@ -0,0 +1,61 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef EXPRESSIO_GRAPH_H
+#define EXPRESSIO_GRAPH_H
+
+#include "global.h"
+#include "types.h"
+#include <vector>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+class DependencyGraph {
+public:
+    DependencyGraph();
+    ~DependencyGraph();
+
+    UInt getSize() const;
+    const std::vector<UInt> & getDependencies(UInt) const;
+    const std::vector<UInt> & getDependents(UInt) const;
+    Bool isReachable(UInt, UInt) const;
+    void sort(UInt, std::vector<UInt> &) const;
+
+    Bool define(UInt, const std::vector<UInt> &);
+    DependencyGraph & remove(UInt);
+    DependencyGraph & clear();
+
+private:
+    std::vector<std::vector<UInt> > dependencies;
+    std::vector<std::vector<UInt> > dependents;
+
+    void reserve(UInt);
+};
+
+EXPRESSIO_NAMESPACE_END
+
+#endif
\ No newline at end of file
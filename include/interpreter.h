@@ -1,107 +1,277 @@
-// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
-//
-// Redistribution and use in source and binary forms, with or without
-// modification, are permitted provided that the following conditions are met:
-//
-// * Redistributions of source code must retain the above copyright notice, this
-//   list of conditions and the following disclaimer.
-//
-// * Redistributions in binary form must reproduce the above copyright notice,
-//   this list of conditions and the following disclaimer in the documentation
-//   and/or other materials provided with the distribution.
-//
-// * Neither the name of the copyright holder nor the names of its
-//   contributors may be used to endorse or promote products derived from
-//   this software without specific prior written permission.
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
-// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
-// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
-// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
-// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-#ifndef EXPRESSIO_INTERPRETER_H
-#define EXPRESSIO_INTERPRETER_H
-
-#include "global.h"
-#include "types.h"
-#include "queue.h"
-#include "ast.h"
-#include "translator.h"
-#include <string>
-
-EXPRESSIO_NAMESPACE_BEGIN
-
-typedef Queue<SymbolPointer> TokenStream;
-typedef Queue<VariableSymbol> VariableTable;
-typedef VariableSymbol Result;
-
-struct ErrorContent {
-    enum Type {
-        UnknownSymbol = 0,
-        InvalidExpression,
-        UndefinedVariable,
-        DivisionByZero,
-        None
-    };
-
-    Type type;
-    UInt position;
-
-    ErrorContent();
-    ErrorContent(Type, UInt = 0);
-    ~ErrorContent();
-};
-
-struct Expression {
-public:
-    Result output;
-    ErrorContent error;
-
-    Expression();
-    Expression(Result, ErrorContent = ErrorContent::None);
-    ~Expression();
-};
-
-class Interpreter {
-public:
-    Interpreter();
-    ~Interpreter();
-
-    Expression run(const std::string &);
-    Interpreter & setTranslator(Translator *);
-    VariableTable getVariableTable() const;
-    Interpreter & clear();
-
-private:
-    Translator * translator;
-    VariableTable variableTable;
-
-    ErrorContent tokenize(const std::string &, TokenStream &) const;
-    ErrorContent parse(const TokenStream &, AbstractSyntaxTree &) const;
-    ErrorContent evaluate(AbstractSyntaxTree::NodePointer, SymbolPointer &);
-
-    void deleteTokens(TokenStream &) const;
-    Bool isVariable(const std::string &, UInt &) const;
-    Bool isNumber(const std::string &, UInt &) const;
-
-    AbstractSyntaxTree::NodePointer literal(TokenStream::ConstIterator &,
-        ErrorContent &) const;
-    AbstractSyntaxTree::NodePointer factor(TokenStream::ConstIterator &,
-        ErrorContent &) const;
-    AbstractSyntaxTree::NodePointer term(TokenStream::ConstIterator &,
-        ErrorContent &) const;
-    AbstractSyntaxTree::NodePointer expression(TokenStream::ConstIterator &,
-        ErrorContent &) const;
-    AbstractSyntaxTree::NodePointer definition(TokenStream::ConstIterator &,
-        ErrorContent &) const;
-};
-
-EXPRESSIO_NAMESPACE_END
-
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef EXPRESSIO_INTERPRETER_H
+#define EXPRESSIO_INTERPRETER_H
+
+#include "global.h"
+#include "types.h"
+#include "queue.h"
+#include "ast.h"
+#include "bytecode.h"
+#include "cache.h"
+#include "graph.h"
+#include "kernel.h"
+#include "native.h"
+#include "optimizer.h"
+#include "syntax.h"
+#include "pool.h"
+#include "table.h"
+#include "trace.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+typedef Queue<Token> TokenStream;
+typedef VariableSymbol Result;
+
+struct ErrorContent {
+    enum Type {
+        UnknownSymbol = 0,
+        InvalidExpression,
+        UndefinedVariable,
+        DivisionByZero,
+        DepthLimitExceeded,
+        None
+    };
+
+    Type type;
+    UInt position;
+
+    ErrorContent();
+    ErrorContent(Type, UInt = 0);
+    ~ErrorContent();
+};
+
+struct Expression {
+public:
+    Result output;
+    ErrorContent error;
+
+    Expression();
+    Expression(Result, ErrorContent = ErrorContent::None);
+    ~Expression();
+};
+
+class CompiledExpression {
+public:
+    enum Backend {
+        VirtualMachine = 0,
+        TreeWalker
+    };
+
+    CompiledExpression();
+    CompiledExpression(const CompiledExpression &);
+    ~CompiledExpression();
+
+    CompiledExpression & operator =(const CompiledExpression &);
+
+    Bool isValid() const;
+    ErrorContent getError() const;
+    UInt getParameterCount() const;
+    std::string getParameterName(UInt) const;
+    UInt getRemovedNodeCount() const;
+    UInt getSharedNodeCount() const;
+    Bool isNative() const;
+    UInt getMemoryUsage() const;
+    Expression evaluate(const VariableTable &, Backend = VirtualMachine) const;
+    Expression evaluate(const Float *) const;
+    ErrorContent evaluate(const Float * const *, UInt, Float *,
+        const Kernel & = Kernel()) const;
+    ErrorContent evaluate(const Float * const *, UInt, Float *, ThreadPool &,
+        UInt = EXPRESSIO_BATCH_CHUNK_SIZE, const Kernel & = Kernel()) const;
+
+private:
+    friend class Interpreter;
+
+    struct Program {
+        TokenStream tokens;
+        SyntaxTree tree;
+        Bytecode bytecode;
+        ErrorContent error;
+
+        Bool isDefinition;
+        std::string target;
+        UInt targetPosition;
+
+        UInt table;
+        std::vector<UInt> slots;
+        UInt targetSlot;
+
+        UInt removedNodeCount;
+        UInt sharedNodeCount;
+
+        Optimizer optimizer;
+        std::vector<Index> operands;
+        std::vector<Token> operators;
+
+        UInt nativeThreshold;
+        mutable std::atomic<UInt> callCount;
+        mutable std::unique_ptr<NativeCode> native;
+        mutable std::atomic<const NativeCode *> nativeCode;
+
+        Program();
+        ~Program();
+
+        Program & clear();
+        const NativeCode * promote() const;
+    };
+
+    std::shared_ptr<const Program> program;
+
+    CompiledExpression(const std::shared_ptr<const Program> &);
+
+    Expression execute(const Float *, UInt, const ErrorContent &) const;
+    Expression walk(const VariableTable &) const;
+    Expression output(Float) const;
+
+};
+
+class Interpreter {
+public:
+    struct Statistics {
+        UInt runs;
+        UInt compilations;
+        UInt tokens;
+        UInt nodes;
+        UInt allocations;
+        UInt workspaceGrowths;
+        UInt workspaceBytes;
+        UInt tokenizeTime;
+        UInt parseTime;
+        UInt optimizeTime;
+        UInt cacheTime;
+        UInt evaluateTime;
+        UInt lookupTime;
+        UInt latencies[EXPRESSIO_LATENCY_BUCKET_COUNT];
+
+        Statistics();
+        ~Statistics();
+
+        UInt getSampleCount() const;
+        UInt getLatency(Float) const;
+        Statistics & record(UInt);
+        Statistics & merge(const Statistics &);
+
+        static UInt getBucket(UInt);
+        static UInt getBucketValue(UInt);
+    };
+
+    Interpreter();
+    ~Interpreter();
+
+    Expression run(const std::string &);
+    Expression run(const Character *, UInt);
+    Expression run(const CompiledExpression &);
+    Expression evaluate(const Character *, UInt, Statistics * = EXPRESSIO_NULL) const;
+    CompiledExpression compile(const std::string &);
+    CompiledExpression compile(const Character *, UInt);
+    Interpreter & setDecimalSeparator(Character);
+    Interpreter & setTracer(Tracer *);
+    Interpreter & setBackend(CompiledExpression::Backend);
+    Interpreter & setOptimization(Bool);
+    Interpreter & setSubexpressionSharing(Bool);
+    Interpreter & setNativeThreshold(UInt);
+    Interpreter & setCacheBudget(UInt);
+    Interpreter & setDepthLimit(UInt);
+    Interpreter & setReactive(Bool);
+    Interpreter & setVariable(const std::string &, Float);
+    const VariableTable & getVariableTable() const;
+    const DependencyGraph & getDependencyGraph() const;
+    std::vector<std::string> getRecomputedVariables() const;
+    LRUCache<CompiledExpression>::Statistics getCacheStatistics() const;
+    const Statistics & getStatistics() const;
+    Interpreter & mergeStatistics(const Statistics &);
+    Interpreter & resetStatistics();
+    Interpreter & clear();
+
+private:
+    Character decimalSeparator;
+    Tracer * tracer;
+    CompiledExpression::Backend backend;
+    Bool optimization;
+    Bool sharing;
+    UInt nativeThreshold;
+    UInt depthLimit;
+    VariableTable variableTable;
+    std::shared_ptr<CompiledExpression::Program> workspace;
+    mutable LRUCache<CompiledExpression> cache;
+    mutable std::mutex cacheMutex;
+    Bool reactive;
+    DependencyGraph dependencyGraph;
+    std::vector<CompiledExpression> definitions;
+    std::vector<UInt> recomputed;
+    std::string key;
+    Statistics statistics;
+    UInt seed;
+
+    typedef std::chrono::steady_clock Clock;
+
+    class Stopwatch {
+    public:
+        Stopwatch(UInt = 1);
+        ~Stopwatch();
+
+        Bool isEnabled() const;
+        UInt getElapsed() const;
+        UInt lap();
+
+    private:
+        UInt scale;
+        Clock::time_point start, time;
+    };
+
+    void compile(const Character *, UInt, CompiledExpression::Program &);
+    void build(const Character *, UInt, CompiledExpression::Program &,
+        Statistics * = EXPRESSIO_NULL) const;
+    Expression evaluate(const CompiledExpression &) const;
+    Expression execute(const CompiledExpression &, Stopwatch &);
+    UInt sample();
+    void propagate(const CompiledExpression &, UInt);
+    void resolve(CompiledExpression::Program &) const;
+    ErrorContent tokenize(const Character *, UInt, TokenStream &, SyntaxTree &) const;
+    ErrorContent parse(const TokenStream &, SyntaxTree &, std::vector<Index> &,
+        std::vector<Token> &) const;
+
+    Bool isVariable(const Character *, UInt, UInt, UInt &) const;
+    Bool isNumber(const Character *, UInt, UInt, UInt &) const;
+    Float toNumber(const Character *, UInt, UInt) const;
+
+    Index expression(TokenStream::ConstIterator &, SyntaxTree &, std::vector<Index> &,
+        std::vector<Token> &, ErrorContent &) const;
+
+    static void reduce(std::vector<Index> &, std::vector<Token> &, SyntaxTree &);
+    static UInt precedence(const Token &);
+};
+
+EXPRESSIO_NAMESPACE_END
+
 #endif
\ No newline at end of file
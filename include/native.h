@@ -0,0 +1,65 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef EXPRESSIO_NATIVE_H
+#define EXPRESSIO_NATIVE_H
+
+#include "global.h"
+#include "types.h"
+#include "bytecode.h"
+#include <vector>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+class NativeCode {
+public:
+    typedef UInt (*Function)(const Float *, Float *);
+
+    NativeCode();
+    ~NativeCode();
+
+    Bool compile(const Bytecode &);
+    Bool isCompiled() const;
+    UInt getSize() const;
+    Bool run(const Float *, Float &, UInt &) const;
+
+    static Bool isEnabled();
+
+private:
+    void * memory;
+    UInt size;
+    Function function;
+
+    NativeCode(const NativeCode &);
+    NativeCode & operator =(const NativeCode &);
+
+    void release();
+};
+
+EXPRESSIO_NAMESPACE_END
+
+#endif
\ No newline at end of file
@@ -0,0 +1,86 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef EXPRESSIO_POOL_H
+#define EXPRESSIO_POOL_H
+
+#include "global.h"
+#include "types.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+class ThreadPool {
+public:
+    typedef std::function<void(UInt)> Task;
+
+    ThreadPool(UInt = 0);
+    ~ThreadPool();
+
+    UInt getThreadCount() const;
+    UInt getStealCount() const;
+    ThreadPool & run(UInt, const Task &);
+
+private:
+    struct Worker {
+        std::mutex mutex;
+        std::deque<UInt> chunks;
+        std::thread thread;
+
+        Worker();
+        ~Worker();
+    };
+
+    std::vector<std::unique_ptr<Worker> > workers;
+    std::mutex mutex, runMutex;
+    std::condition_variable started, finished;
+    UInt generation;
+    Bool stopping;
+
+    const Task * task;
+    std::atomic<UInt> remaining;
+    std::atomic<UInt> steals;
+
+    ThreadPool(const ThreadPool &);
+    ThreadPool & operator =(const ThreadPool &);
+
+    void work(UInt);
+    void execute(UInt);
+    Bool pop(UInt, UInt &);
+    Bool steal(UInt, UInt &);
+};
+
+EXPRESSIO_NAMESPACE_END
+
+#endif
\ No newline at end of file
@@ -0,0 +1,107 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef EXPRESSIO_SYNTAX_H
+#define EXPRESSIO_SYNTAX_H
+
+#include "global.h"
+#include "types.h"
+#include "ast.h"
+#include <string>
+#include <vector>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+class SyntaxTree {
+public:
+    struct Node {
+        Symbol::Type type;
+        Index position;
+        Index left, right;
+
+        union {
+            Float value;
+            Index name;
+        };
+
+        Node();
+        Node(Symbol::Type, Index, Index, Index);
+        ~Node();
+
+        Bool isLeaf() const;
+        Bool isNumber(Float) const;
+    };
+
+    SyntaxTree();
+    ~SyntaxTree();
+
+    UInt getSize() const;
+    Index getRoot() const;
+    const Node & getNode(Index) const;
+    Node & getNode(Index);
+    const std::vector<Node> & getNodes() const;
+    UInt getNameCount() const;
+    const std::string & getName(Index) const;
+    UInt getMemoryUsage() const;
+    Bool isEmpty() const;
+
+    Index addNumber(Float, Index);
+    Index addVariable(const std::string &, Index);
+    Index addVariable(Index, Index);
+    Index intern(const std::string &);
+    Index addOperator(Symbol::Type, Index, Index, Index);
+    Index add(const Node &);
+    SyntaxTree & setRoot(Index);
+    SyntaxTree & assign(std::vector<Node> &, Index);
+    SyntaxTree & compact();
+    SyntaxTree & clear();
+
+    static Float compute(Symbol::Type, Float, Float);
+
+private:
+    struct Bucket {
+        UInt generation;
+        Index name;
+
+        Bucket();
+        ~Bucket();
+    };
+
+    std::vector<Node> nodes;
+    std::vector<std::string> names;
+    std::vector<Bucket> buckets;
+    std::vector<Index> indices;
+    std::vector<Bool> reachable;
+    UInt generation;
+    Index root;
+
+    void rehash(UInt);
+};
+
+EXPRESSIO_NAMESPACE_END
+
+#endif
\ No newline at end of file
@@ -0,0 +1,76 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef EXPRESSIO_TABLE_H
+#define EXPRESSIO_TABLE_H
+
+#include "global.h"
+#include "types.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+class VariableTable {
+public:
+    VariableTable();
+    VariableTable(const VariableTable &);
+    ~VariableTable();
+
+    VariableTable & operator =(const VariableTable &);
+
+    UInt getIdentity() const;
+    UInt getSize() const;
+    UInt getSlotCount() const;
+    Bool isEmpty() const;
+    Bool isDefined(UInt) const;
+    const std::string & getName(UInt) const;
+    Float getValue(UInt) const;
+    const Float * getValues() const;
+    Bool find(const std::string &, UInt &) const;
+
+    UInt intern(const std::string &);
+    VariableTable & insert(const std::string &, Float);
+    VariableTable & setValue(UInt, Float);
+    VariableTable & remove(UInt);
+    VariableTable & clear();
+
+private:
+    std::unordered_map<std::string, UInt> index;
+    std::vector<std::string> names;
+    std::vector<Float> values;
+    std::vector<Bool> defined;
+    UInt size;
+    UInt identity;
+
+    static UInt createIdentity();
+};
+
+EXPRESSIO_NAMESPACE_END
+
+#endif
\ No newline at end of file
@@ -0,0 +1,119 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef EXPRESSIO_TRACE_H
+#define EXPRESSIO_TRACE_H
+
+#include "global.h"
+#include "types.h"
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+class Tracer {
+public:
+    struct Event {
+        const Character * name;
+        const Character * category;
+        UInt begin;
+        UInt duration;
+
+        Event();
+        Event(const Character *, const Character *, UInt, UInt);
+        ~Event();
+    };
+
+    class Scope {
+    public:
+        Scope(Tracer *, const Character *, const Character *);
+        ~Scope();
+
+    private:
+        Tracer * tracer;
+        const Character * name;
+        const Character * category;
+        UInt begin;
+
+        Scope(const Scope &);
+        Scope & operator =(const Scope &);
+    };
+
+    Tracer(UInt = EXPRESSIO_TRACE_BUFFER_SIZE);
+    ~Tracer();
+
+    UInt now() const;
+    UInt getThreadCount() const;
+    UInt getEventCount() const;
+    UInt getDroppedCount() const;
+    Tracer & record(const Character *, const Character *, UInt, UInt);
+    Tracer & clear();
+    Bool write(const std::string &) const;
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    struct Buffer {
+        UInt thread;
+        std::thread::id owner;
+        std::vector<Event> events;
+        Buffer * next;
+
+        Buffer(UInt, std::thread::id, UInt);
+        ~Buffer();
+    };
+
+    UInt id;
+    UInt capacity;
+    Clock::time_point origin;
+    std::atomic<Buffer *> buffers;
+    std::atomic<UInt> threadCount;
+    std::atomic<UInt> dropped;
+
+    Tracer(const Tracer &);
+    Tracer & operator =(const Tracer &);
+
+    Buffer * getBuffer();
+};
+
+inline Tracer::Scope::Scope(Tracer * tracer, const Character * name,
+    const Character * category) : tracer(tracer), name(name), category(category), begin(0) {
+    if (tracer != EXPRESSIO_NULL)
+        begin = tracer->now();
+}
+inline Tracer::Scope::~Scope() {
+    if (tracer != EXPRESSIO_NULL)
+        tracer->record(name, category, begin, tracer->now());
+}
+
+EXPRESSIO_NAMESPACE_END
+
+#endif
\ No newline at end of file
@@ -0,0 +1,78 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "allocation.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+static std::atomic<UInt> allocationCount(0);
+static std::atomic<UInt> deallocationCount(0);
+static std::atomic<UInt> allocatedBytes(0);
+
+AllocationCounter::Statistics::Statistics() : allocations(0), deallocations(0), bytes(0) {}
+AllocationCounter::Statistics::~Statistics() {}
+
+AllocationCounter::Statistics AllocationCounter::getStatistics() {
+    Statistics statistics;
+
+    statistics.allocations = allocationCount.load(std::memory_order_relaxed);
+    statistics.deallocations = deallocationCount.load(std::memory_order_relaxed);
+    statistics.bytes = allocatedBytes.load(std::memory_order_relaxed);
+
+    return statistics;
+}
+
+EXPRESSIO_NAMESPACE_END
+
+void * operator new(std::size_t size) {
+    expressio::allocationCount.fetch_add(1, std::memory_order_relaxed);
+    expressio::allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+
+    void * memory;
+
+    while ((memory = std::malloc(size != 0 ? size : 1)) == EXPRESSIO_NULL) {
+        std::new_handler handler = std::get_new_handler();
+
+        if (handler == EXPRESSIO_NULL)
+            throw std::bad_alloc();
+
+        handler();
+    }
+
+    return memory;
+}
+void operator delete(void * memory) noexcept {
+    if (memory == EXPRESSIO_NULL)
+        return;
+
+    expressio::deallocationCount.fetch_add(1, std::memory_order_relaxed);
+    std::free(memory);
+}
\ No newline at end of file
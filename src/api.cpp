@@ -0,0 +1,276 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "api.h"
+#include "interpreter.h"
+#include <cctype>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+EXPRESSIO_NAMESPACE_USING
+
+struct expressio_interpreter {
+    std::shared_ptr<Interpreter> interpreter;
+
+    expressio_interpreter();
+    ~expressio_interpreter();
+};
+
+struct expressio_expression {
+    std::shared_ptr<const Interpreter> owner;
+    CompiledExpression compiledExpression;
+    std::vector<std::string> parameters;
+
+    expressio_expression(const std::shared_ptr<const Interpreter> &,
+        const CompiledExpression &);
+    ~expressio_expression();
+};
+
+expressio_interpreter::expressio_interpreter() : interpreter(new Interpreter) {}
+expressio_interpreter::~expressio_interpreter() {}
+
+expressio_expression::expressio_expression(const std::shared_ptr<const Interpreter> & owner,
+    const CompiledExpression & compiledExpression)
+    : owner(owner), compiledExpression(compiledExpression) {
+    for (UInt i = 0; i < compiledExpression.getParameterCount(); i++)
+        parameters.push_back(compiledExpression.getParameterName(i));
+}
+expressio_expression::~expressio_expression() {}
+
+static expressio_status toStatus(const ErrorContent & error, size_t * position) {
+    if (position != EXPRESSIO_NULL)
+        *position = error.position;
+
+    switch (error.type) {
+    case ErrorContent::UnknownSymbol:
+        return EXPRESSIO_UNKNOWN_SYMBOL;
+    case ErrorContent::InvalidExpression:
+        return EXPRESSIO_INVALID_EXPRESSION;
+    case ErrorContent::UndefinedVariable:
+        return EXPRESSIO_UNDEFINED_VARIABLE;
+    case ErrorContent::DivisionByZero:
+        return EXPRESSIO_DIVISION_BY_ZERO;
+    case ErrorContent::DepthLimitExceeded:
+        return EXPRESSIO_DEPTH_LIMIT_EXCEEDED;
+    default:
+        return EXPRESSIO_OK;
+    }
+}
+static expressio_status toResult(const Expression & expression, double * value,
+    size_t * position) {
+    if (expression.error.type == ErrorContent::None && value != EXPRESSIO_NULL)
+        *value = expression.output.value;
+
+    return toStatus(expression.error, position);
+}
+static Bool isName(const char * name) {
+    if (name == EXPRESSIO_NULL || *name == '\0')
+        return false;
+
+    for (; *name != '\0'; name++) {
+        if (!std::isalpha((unsigned char)*name))
+            return false;
+    }
+
+    return true;
+}
+
+const char * expressio_version(void) {
+    return EXPRESSIO_VERSION;
+}
+const char * expressio_status_string(expressio_status status) {
+    switch (status) {
+    case EXPRESSIO_OK:
+        return "ok";
+    case EXPRESSIO_UNKNOWN_SYMBOL:
+        return "unknown symbol";
+    case EXPRESSIO_INVALID_EXPRESSION:
+        return "invalid expression";
+    case EXPRESSIO_UNDEFINED_VARIABLE:
+        return "undefined variable";
+    case EXPRESSIO_DIVISION_BY_ZERO:
+        return "division by zero";
+    case EXPRESSIO_DEPTH_LIMIT_EXCEEDED:
+        return "depth limit exceeded";
+    case EXPRESSIO_INVALID_ARGUMENT:
+        return "invalid argument";
+    case EXPRESSIO_OUT_OF_MEMORY:
+        return "out of memory";
+    default:
+        return "unknown status";
+    }
+}
+
+expressio_interpreter * expressio_interpreter_create(void) {
+    try {
+        return new expressio_interpreter;
+    }
+    catch (const std::bad_alloc &) {
+        return EXPRESSIO_NULL;
+    }
+}
+void expressio_interpreter_destroy(expressio_interpreter * interpreter) {
+    delete interpreter;
+}
+expressio_status expressio_interpreter_set_decimal_separator(
+    expressio_interpreter * interpreter, char decimalSeparator) {
+    if (interpreter == EXPRESSIO_NULL || std::isalnum((unsigned char)decimalSeparator))
+        return EXPRESSIO_INVALID_ARGUMENT;
+
+    interpreter->interpreter->setDecimalSeparator(decimalSeparator);
+
+    return EXPRESSIO_OK;
+}
+expressio_status expressio_interpreter_set_depth_limit(expressio_interpreter * interpreter,
+    size_t depthLimit) {
+    if (interpreter == EXPRESSIO_NULL)
+        return EXPRESSIO_INVALID_ARGUMENT;
+
+    interpreter->interpreter->setDepthLimit(depthLimit);
+
+    return EXPRESSIO_OK;
+}
+
+expressio_status expressio_bind(expressio_interpreter * interpreter, const char * name,
+    double value) {
+    if (interpreter == EXPRESSIO_NULL || !isName(name))
+        return EXPRESSIO_INVALID_ARGUMENT;
+
+    try {
+        interpreter->interpreter->setVariable(name, value);
+    }
+    catch (const std::bad_alloc &) {
+        return EXPRESSIO_OUT_OF_MEMORY;
+    }
+
+    return EXPRESSIO_OK;
+}
+expressio_status expressio_lookup(const expressio_interpreter * interpreter, const char * name,
+    double * value) {
+    if (interpreter == EXPRESSIO_NULL || name == EXPRESSIO_NULL || value == EXPRESSIO_NULL)
+        return EXPRESSIO_INVALID_ARGUMENT;
+
+    const VariableTable & variableTable = interpreter->interpreter->getVariableTable();
+    UInt slot;
+
+    if (!variableTable.find(name, slot) || !variableTable.isDefined(slot))
+        return EXPRESSIO_UNDEFINED_VARIABLE;
+
+    *value = variableTable.getValue(slot);
+
+    return EXPRESSIO_OK;
+}
+expressio_status expressio_run(expressio_interpreter * interpreter, const char * source,
+    size_t length, double * value, size_t * position) {
+    if (interpreter == EXPRESSIO_NULL || (source == EXPRESSIO_NULL && length != 0))
+        return EXPRESSIO_INVALID_ARGUMENT;
+
+    try {
+        return toResult(interpreter->interpreter->run(source, length), value, position);
+    }
+    catch (const std::bad_alloc &) {
+        return EXPRESSIO_OUT_OF_MEMORY;
+    }
+}
+
+expressio_status expressio_compile(expressio_interpreter * interpreter, const char * source,
+    size_t length, expressio_expression ** expression, size_t * position) {
+    if (interpreter == EXPRESSIO_NULL || expression == EXPRESSIO_NULL
+        || (source == EXPRESSIO_NULL && length != 0))
+        return EXPRESSIO_INVALID_ARGUMENT;
+
+    *expression = EXPRESSIO_NULL;
+
+    try {
+        CompiledExpression compiledExpression = interpreter->interpreter->compile(source, length);
+
+        if (!compiledExpression.isValid())
+            return toStatus(compiledExpression.getError(), position);
+
+        *expression = new expressio_expression(interpreter->interpreter, compiledExpression);
+    }
+    catch (const std::bad_alloc &) {
+        return EXPRESSIO_OUT_OF_MEMORY;
+    }
+
+    return EXPRESSIO_OK;
+}
+void expressio_expression_destroy(expressio_expression * expression) {
+    delete expression;
+}
+size_t expressio_expression_parameter_count(const expressio_expression * expression) {
+    return expression != EXPRESSIO_NULL ? expression->parameters.size() : 0;
+}
+const char * expressio_expression_parameter_name(const expressio_expression * expression,
+    size_t index) {
+    if (expression == EXPRESSIO_NULL || index >= expression->parameters.size())
+        return EXPRESSIO_NULL;
+
+    return expression->parameters[index].c_str();
+}
+expressio_status expressio_evaluate(const expressio_expression * expression, double * value,
+    size_t * position) {
+    if (expression == EXPRESSIO_NULL)
+        return EXPRESSIO_INVALID_ARGUMENT;
+
+    try {
+        return toResult(expression->compiledExpression.evaluate(
+            expression->owner->getVariableTable()), value, position);
+    }
+    catch (const std::bad_alloc &) {
+        return EXPRESSIO_OUT_OF_MEMORY;
+    }
+}
+expressio_status expressio_evaluate_values(const expressio_expression * expression,
+    const double * parameters, double * value, size_t * position) {
+    if (expression == EXPRESSIO_NULL
+        || (parameters == EXPRESSIO_NULL && !expression->parameters.empty()))
+        return EXPRESSIO_INVALID_ARGUMENT;
+
+    try {
+        return toResult(expression->compiledExpression.evaluate(parameters), value, position);
+    }
+    catch (const std::bad_alloc &) {
+        return EXPRESSIO_OUT_OF_MEMORY;
+    }
+}
+expressio_status expressio_evaluate_batch(const expressio_expression * expression,
+    const double * const * columns, size_t rows, double * output, size_t * position) {
+    if (expression == EXPRESSIO_NULL || output == EXPRESSIO_NULL
+        || (columns == EXPRESSIO_NULL && !expression->parameters.empty()))
+        return EXPRESSIO_INVALID_ARGUMENT;
+
+    try {
+        return toStatus(expression->compiledExpression.evaluate(columns, rows, output), position);
+    }
+    catch (const std::bad_alloc &) {
+        return EXPRESSIO_OUT_OF_MEMORY;
+    }
+}
\ No newline at end of file
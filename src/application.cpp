@@ -1,542 +1,823 @@
-// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
-//
-// Redistribution and use in source and binary forms, with or without
-// modification, are permitted provided that the following conditions are met:
-//
-// * Redistributions of source code must retain the above copyright notice, this
-//   list of conditions and the following disclaimer.
-//
-// * Redistributions in binary form must reproduce the above copyright notice,
-//   this list of conditions and the following disclaimer in the documentation
-//   and/or other materials provided with the distribution.
-//
-// * Neither the name of the copyright holder nor the names of its
-//   contributors may be used to endorse or promote products derived from
-//   this software without specific prior written permission.
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
-// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
-// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
-// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
-// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-#include "application.h"
-#include <iostream>
-#include <iomanip>
-#include <cstdlib>
-#include <sstream>
-#include <fstream>
-
-EXPRESSIO_NAMESPACE_BEGIN
-
-Application::Preferences::Preferences(const Translator::Language & language,
-    const Theme & theme) : language(language), theme(theme) {}
-Application::Preferences::~Preferences() {}
-
-Application::Application() {
-    preferenceFile = fopen("preferences", "rb+");
-
-    if (preferenceFile != EXPRESSIO_NULL) {
-        fread(&preferences, sizeof(Preferences), 1, preferenceFile);
-    }
-    else {
-        preferenceFile = fopen("preferences", "wb+");
-
-        if (preferenceFile != EXPRESSIO_NULL)
-            fwrite(&preferences, sizeof(Preferences), 1, preferenceFile);
-    }
-
-    fclose(preferenceFile);
-
-    translator.setLanguage(preferences.language);
-
-#if _WIN64
-    setTheme(preferences.theme);
-#endif
-
-    interpreter.setTranslator(&translator);
-
-    clear();
-}
-Application::~Application() {
-    if (preferenceFile != EXPRESSIO_NULL)
-        fclose(preferenceFile);
-}
-
-UInt Application::execute() {
-    clear();
-
-    createTitle();
-    separator();
-
-    if (!message.empty()) {
-        print(message);
-        separator();
-
-        message.clear();
-    }
-
-    Queue<std::string> menu;
-    menu.insert(translator.EDITOR);
-    menu.insert(translator.CLEAR);
-    menu.insert(translator.EXPORT);
-    menu.insert(translator.PREFERENCES);
-    menu.insert(translator.ABOUT);
-    menu.insert(translator.EXIT);
-
-    createMenu(menu);
-    separator();
-
-    requestOption();
-
-    switch (option) {
-    case 1:
-        editorAction();
-        break;
-    case 2:
-        if (!historyList.isEmpty())
-            clearAction();
-        else {
-            message = translator.EMPTY_HISTORY_LIST_WARNING;
-            execute();
-        }
-
-        break;
-    case 3:
-        if (!historyList.isEmpty())
-            exportAction();
-        else {
-            message = translator.EMPTY_HISTORY_LIST_WARNING;
-            execute();
-        }
-
-        break;
-    case 4:
-        preferencesAction();
-        break;
-    case 5:
-        aboutAction();
-        break;
-    case 6:
-        exitAction();
-        break;
-    default:
-        execute();
-    }
-
-    return 0;
-}
-
-void Application::setTheme(const Theme & theme) {
-    switch (theme) {
-    case Theme::Dark:
-        system("color 0F");
-        break;
-    default:
-        system("color F0");
-    }
-}
-void Application::requestText(std::string & string) {
-    std::getline(std::cin, string);
-}
-void Application::requestOption() {
-    std::string stringOption;
-
-    requestText(stringOption);
-    stringOption = stringOption.substr(0, EXPRESSIO_MAX_OPTION_LENGTH);
-
-    option = isUInt(stringOption) ? std::stoi(stringOption) : 0;
-}
-
-void Application::createTitle() {
-    print("* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *");
-    print("*                                  EXPRESSIO                                  *");
-    print("* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *");
-}
-void Application::createMenu(const Queue<std::string> & menu) {
-    Queue<std::string>::ConstIterator it = menu.getBegin();
-
-    for (UInt i = 0; i < menu.getSize(); i++)
-        std::cout << i + 1 << ". " << *it++ << std::endl;
-}
-void Application::print(const std::string & string) {
-    std::cout << string << std::endl;
-}
-void Application::separator() {
-    std::cout << std::endl;
-}
-void Application::clear() {
-#ifdef _WIN64
-    system("cls");
-#else
-    system("clear");
-#endif
-}
-
-Bool Application::isUInt(const std::string & string) const {
-    UInt type;
-    std::stringstream sstream(string);
-
-    sstream >> std::noskipws >> type;
-
-    return sstream && sstream.eof();
-}
-
-void Application::editorAction() {
-    clear();
-
-    createTitle();
-    separator();
-
-    print(translator.EDITOR);
-    separator();
-
-    print(translator.EDITOR_MESSAGE);
-    separator();
-
-    if (!historyList.isEmpty()) {
-        Queue<std::string>::Iterator it(historyList.getBegin());
-
-        while (it != historyList.getEnd())
-            print(*it++);
-
-        separator();
-    }
-
-    std::string source, result;
-
-    do {
-        requestText(source);
-        historyList.insert(source);
-
-        Expression expression = interpreter.run(source);
-
-        if (expression.error.type == ErrorContent::None) {
-            Result variable = expression.output;
-
-            result = ">> ";
-
-            if (variable.isOutput)
-                result += variable.name + " = ";
-
-            std::stringstream sstream;
-            sstream << std::fixed << std::setprecision(5) << variable.value;
-
-            result += sstream.str();
-        }
-        else {
-            result += std::string(expression.error.position, ' ');
-            result += "^\n>> ";
-
-            switch (expression.error.type) {
-            case ErrorContent::UnknownSymbol:
-                result += translator.UNKNOWN_SYMBOL_ERROR;
-                break;
-            case ErrorContent::InvalidExpression:
-                result += translator.INVALID_EXPRESSION_ERROR;
-                break;
-            case ErrorContent::UndefinedVariable:
-                result += translator.UNDEFINED_VARIABLE_ERROR;
-                break;
-            case ErrorContent::DivisionByZero:
-                result += translator.DIVISION_BY_ZERO_ERROR;
-                break;
-            }
-        }
-
-        historyList.insert(result);
-
-        print(result);
-        separator();
-
-        result.clear();
-
-        Queue<std::string> menu;
-        menu.insert(translator.CONTINUE);
-        menu.insert(translator.CANCEL);
-        menu.insert(translator.EXIT);
-
-        createMenu(menu);
-        separator();
-
-        requestOption();
-        separator();
-    } while (option == 1);
-
-    switch (option) {
-    case 2:
-        execute();
-        break;
-    case 3:
-        exitAction();
-        break;
-    default:
-        editorAction();
-    }
-}
-void Application::clearAction() {
-    clear();
-
-    createTitle();
-    separator();
-
-    print(translator.CLEAR);
-    separator();
-
-    print(translator.CLEAR_MESSAGE);
-    separator();
-
-    Queue<std::string> menu;
-    menu.insert(translator.YES);
-    menu.insert(translator.NO);
-    menu.insert(translator.EXIT);
-
-    createMenu(menu);
-    separator();
-
-    requestOption();
-    separator();
-
-    switch (option) {
-    case 1:
-        historyList.clear();
-        interpreter.clear();
-
-        execute();
-
-        break;
-    case 2:
-        execute();
-        break;
-    case 3:
-        exitAction();
-        break;
-    default:
-        clearAction();
-    }
-}
-void Application::exportAction() {
-    clear();
-
-    createTitle();
-    separator();
-
-    print(translator.EXPORT);
-    separator();
-
-    print(translator.EXPORT_MESSAGE);
-
-    std::string filename;
-    std::fstream file;
-
-    requestText(filename);
-    separator();
-
-    Queue<std::string> menu;
-    menu.insert(translator.EXPORT);
-    menu.insert(translator.CANCEL);
-    menu.insert(translator.EXIT);
-
-    createMenu(menu);
-    separator();
-
-    requestOption();
-    separator();
-
-    switch (option) {
-    case 1:
-        file.open(filename, std::fstream::out);
-
-        if (file.is_open()) {
-            Queue<std::string>::Iterator it(historyList.getBegin());
-
-            while (it != historyList.getEnd())
-                file << *it++ << std::endl;
-
-            file.close();
-
-            execute();
-        }
-        else
-            exportAction();
-
-        break;
-    case 2:
-        execute();
-        break;
-    case 3:
-        exitAction();
-        break;
-    default:
-        exportAction();
-    }
-}
-void Application::preferencesAction() {
-    clear();
-
-    createTitle();
-    separator();
-
-    print(translator.PREFERENCES);
-    separator();
-
-    print(translator.LANGUAGE_MESSAGE);
-    separator();
-
-    Queue<std::string> menu;
-    menu.insert(translator.ENGLISH);
-    menu.insert(translator.PORTUGUESE);
-    menu.insert(translator.DEFAULT);
-
-    createMenu(menu);
-    separator();
-
-    requestOption();
-    separator();
-
-    if (option < 1 || option > menu.getSize())
-        preferencesAction();
-
-    preferences.language = (Translator::Language)(option - 1);
-
-#ifdef _WIN64
-    print(translator.THEME_MESSAGE);
-    separator();
-
-    menu.clear();
-    menu.insert(translator.LIGHT);
-    menu.insert(translator.DARK);
-    menu.insert(translator.DEFAULT);
-
-    createMenu(menu);
-    separator();
-
-    requestOption();
-    separator();
-
-    if (option < 1 || option > menu.getSize())
-        preferencesAction();
-
-    preferences.theme = (Theme)(option - 1);
-#endif
-
-    menu.clear();
-    menu.insert(translator.SAVE);
-    menu.insert(translator.CANCEL);
-    menu.insert(translator.EXIT);
-
-    createMenu(menu);
-    separator();
-
-    requestOption();
-
-    switch (option) {
-    case 1:
-        preferenceFile = fopen("preferences", "wb+");
-
-        if (preferenceFile != EXPRESSIO_NULL)
-            fwrite(&preferences, sizeof(Preferences), 1, preferenceFile);
-
-        fclose(preferenceFile);
-
-        if (preferences.language != translator.getLanguage()) {
-            historyList.clear();
-            interpreter.clear();
-        }
-
-        translator.setLanguage(preferences.language);
-
-#ifdef _WIN64
-        setTheme(preferences.theme);
-#endif
-
-        execute();
-
-        break;
-    case 2:
-        execute();
-        break;
-    case 3:
-        exitAction();
-        break;
-    default:
-        preferencesAction();
-    }
-}
-void Application::aboutAction() {
-    clear();
-
-    createTitle();
-    separator();
-
-    print(translator.ABOUT);
-    separator();
-
-    print(translator.ABOUT_MESSAGE);
-    separator();
-
-    print(translator.COPYRIGHT_MESSAGE);
-    print(translator.LICENSE_MESSAGE);
-    separator();
-
-    Queue<std::string> menu;
-    menu.insert(translator.OK);
-    menu.insert(translator.EXIT);
-
-    createMenu(menu);
-    separator();
-
-    requestOption();
-    separator();
-
-    switch (option) {
-    case 1:
-        execute();
-        break;
-    case 2:
-        exitAction();
-        break;
-    default:
-        aboutAction();
-    }
-}
-void Application::exitAction() {
-    clear();
-
-    createTitle();
-    separator();
-
-    print(translator.EXIT);
-    separator();
-
-    print(translator.EXIT_MESSAGE);
-    separator();
-
-    Queue<std::string> menu;
-    menu.insert(translator.YES);
-    menu.insert(translator.NO);
-
-    createMenu(menu);
-    separator();
-
-    requestOption();
-    separator();
-
-    switch (option) {
-    case 1:
-        return;
-        break;
-    case 2:
-        execute();
-        break;
-    default:
-        exitAction();
-    }
-}
-
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "application.h"
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <sstream>
+#include <fstream>
+#include <cstring>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+Application::Preferences::Preferences(const Translator::Language & language,
+    const Theme & theme) : language(language), theme(theme) {}
+Application::Preferences::~Preferences() {}
+
+Application::Application() {
+    if (!loadPreferences())
+        savePreferences();
+
+    translator.setLanguage(preferences.language);
+
+#if _WIN64
+    setTheme(preferences.theme);
+#endif
+
+    interpreter.setDecimalSeparator(translator.DECIMAL_SEPARATOR);
+}
+Application::~Application() {}
+
+UInt Application::execute() {
+    clear();
+
+    createTitle();
+    separator();
+
+    if (!message.empty()) {
+        print(message);
+        separator();
+
+        message.clear();
+    }
+
+    Queue<std::string> menu;
+    menu.insert(translator.EDITOR);
+    menu.insert(translator.CLEAR);
+    menu.insert(translator.EXPORT);
+    menu.insert(translator.PREFERENCES);
+    menu.insert(translator.ABOUT);
+    menu.insert(translator.EXIT);
+
+    createMenu(menu);
+    separator();
+
+    requestOption();
+
+    switch (option) {
+    case 1:
+        editorAction();
+        break;
+    case 2:
+        if (!historyList.isEmpty())
+            clearAction();
+        else {
+            message = translator.EMPTY_HISTORY_LIST_WARNING;
+            execute();
+        }
+
+        break;
+    case 3:
+        if (!historyList.isEmpty())
+            exportAction();
+        else {
+            message = translator.EMPTY_HISTORY_LIST_WARNING;
+            execute();
+        }
+
+        break;
+    case 4:
+        preferencesAction();
+        break;
+    case 5:
+        aboutAction();
+        break;
+    case 6:
+        exitAction();
+        break;
+    default:
+        execute();
+    }
+
+    return 0;
+}
+UInt Application::batch(const std::string & filename, Bool parallel) {
+    Tracer::Scope scope(tracer.get(), "batch", "application");
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::unique_ptr<ThreadPool> pool(parallel ? new ThreadPool : EXPRESSIO_NULL);
+    std::string output;
+    UInt bytes = 0;
+
+    if (pool && pool->getThreadCount() < 2)
+        pool.reset();
+
+    output.reserve(2 * EXPRESSIO_STREAM_BUFFER_SIZE);
+
+    MappedFile file;
+
+    if (!filename.empty() && file.open(filename)) {
+        if (file.getSize() != 0) {
+            const Character * begin = file.getData();
+            const Character * end = begin + file.getSize();
+
+            begin = evaluateLines(begin, end, output, pool.get());
+
+            if (begin != end)
+                evaluateLine(begin, end, output);
+        }
+
+        bytes = file.getSize();
+    }
+    else {
+        FILE * stream = filename.empty() ? stdin : fopen(filename.c_str(), "rb");
+
+        if (stream == EXPRESSIO_NULL) {
+            fprintf(stderr, "Unable to open %s.\n", filename.c_str());
+
+            return 1;
+        }
+
+        std::vector<Character> buffer(parallel ? EXPRESSIO_PARALLEL_BUFFER_SIZE :
+            EXPRESSIO_STREAM_BUFFER_SIZE);
+        std::string line;
+        UInt size;
+
+        while ((size = fread(buffer.data(), 1, buffer.size(), stream)) > 0) {
+            const Character * begin = buffer.data();
+            const Character * end = begin + size;
+
+            bytes += size;
+
+            if (!line.empty()) {
+                const Character * newline = (const Character *)memchr(begin, '\n', size);
+
+                if (newline == EXPRESSIO_NULL) {
+                    line.append(begin, end);
+                    continue;
+                }
+
+                line.append(begin, newline);
+                evaluateLine(line.data(), line.data() + line.length(), output);
+
+                begin = newline + 1;
+            }
+
+            line.assign(evaluateLines(begin, end, output, pool.get()), end);
+        }
+
+        if (!line.empty())
+            evaluateLine(line.data(), line.data() + line.length(), output);
+
+        if (stream != stdin)
+            fclose(stream);
+    }
+
+    fwrite(output.data(), 1, output.size(), stdout);
+    fflush(stdout);
+
+    Float seconds = std::chrono::duration<Float>(std::chrono::steady_clock::now() - start).count();
+
+    fprintf(stderr, "%llu bytes in %.3f s (%.0f bytes/s)\n", (unsigned long long)bytes,
+        seconds, seconds > 0 ? bytes / seconds : 0);
+
+    return 0;
+}
+
+void Application::printStatistics() const {
+    const Interpreter::Statistics & statistics = interpreter.getStatistics();
+    LRUCache<CompiledExpression>::Statistics cache = interpreter.getCacheStatistics();
+
+    AllocationCounter::Statistics heap = AllocationCounter::getStatistics();
+
+    const Character * names[] = { "runs", "compilations", "tokens", "nodes",
+        "program allocations", "workspace growths", "workspace bytes", "cache hits",
+        "cache misses", "cache evictions", "heap allocations", "heap deallocations",
+        "heap bytes" };
+    UInt counts[] = { statistics.runs, statistics.compilations, statistics.tokens,
+        statistics.nodes, statistics.allocations, statistics.workspaceGrowths,
+        statistics.workspaceBytes, cache.hits, cache.misses, cache.evictions,
+        heap.allocations, heap.deallocations, heap.bytes };
+
+    for (UInt i = 0; i < sizeof(counts) / sizeof(UInt); i++)
+        fprintf(stderr, "%-24s %16llu\n", names[i], (unsigned long long)counts[i]);
+
+    UInt samples = statistics.getSampleCount();
+
+    fprintf(stderr, "%-24s %16llu\n", "timing samples", (unsigned long long)samples);
+
+    if (samples < EXPRESSIO_STATISTICS_SAMPLE_MINIMUM) {
+        fprintf(stderr, "timings omitted: fewer than %d timed runs\n",
+            EXPRESSIO_STATISTICS_SAMPLE_MINIMUM);
+
+        return;
+    }
+
+    const Character * phases[] = { "tokenize", "parse", "optimize", "cache", "evaluate",
+        "lookup" };
+    UInt times[] = { statistics.tokenizeTime, statistics.parseTime, statistics.optimizeTime,
+        statistics.cacheTime, statistics.evaluateTime, statistics.lookupTime };
+
+    for (UInt i = 0; i < sizeof(times) / sizeof(UInt); i++)
+        fprintf(stderr, "%-24s %16llu ns\n", phases[i], (unsigned long long)times[i]);
+
+    fprintf(stderr, "%-24s %16llu ns\n", "latency p50",
+        (unsigned long long)statistics.getLatency(0.5));
+    fprintf(stderr, "%-24s %16llu ns\n", "latency p99",
+        (unsigned long long)statistics.getLatency(0.99));
+}
+Application & Application::setTracing(Bool tracing) {
+    tracer.reset(tracing ? new Tracer : EXPRESSIO_NULL);
+    interpreter.setTracer(tracer.get());
+
+    return *this;
+}
+Bool Application::writeTrace(const std::string & filename) const {
+    if (!tracer || !tracer->write(filename))
+        return false;
+
+    fprintf(stderr, "%llu trace events (%llu threads) written to %s\n",
+        (unsigned long long)tracer->getEventCount(),
+        (unsigned long long)tracer->getThreadCount(), filename.c_str());
+
+    if (tracer->getDroppedCount() != 0)
+        fprintf(stderr, "%llu trace events dropped\n",
+            (unsigned long long)tracer->getDroppedCount());
+
+    return true;
+}
+Bool Application::loadPreferences() {
+    std::ifstream file("preferences", std::ios::binary);
+
+    return file.is_open() && file.read((Character *)&preferences, sizeof(Preferences));
+}
+Bool Application::savePreferences() const {
+    std::ofstream file("preferences", std::ios::binary | std::ios::trunc);
+
+    return file.is_open() && file.write((const Character *)&preferences, sizeof(Preferences));
+}
+void Application::setTheme(const Theme & theme) {
+    switch (theme) {
+    case Theme::Dark:
+        system("color 0F");
+        break;
+    default:
+        system("color F0");
+    }
+}
+void Application::requestText(std::string & string) {
+    std::getline(std::cin, string);
+}
+void Application::requestOption() {
+    std::string stringOption;
+
+    requestText(stringOption);
+    stringOption = stringOption.substr(0, EXPRESSIO_MAX_OPTION_LENGTH);
+
+    option = isUInt(stringOption) ? std::stoi(stringOption) : 0;
+}
+
+void Application::createTitle() {
+    print("* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *");
+    print("*                                  EXPRESSIO                                  *");
+    print("* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * *");
+}
+void Application::createMenu(const Queue<std::string> & menu) {
+    Queue<std::string>::ConstIterator it = menu.getBegin();
+
+    for (UInt i = 0; i < menu.getSize(); i++)
+        std::cout << i + 1 << ". " << *it++ << std::endl;
+}
+void Application::print(const std::string & string) {
+    std::cout << string << std::endl;
+}
+void Application::separator() {
+    std::cout << std::endl;
+}
+void Application::clear() {
+#ifdef _WIN64
+    system("cls");
+#else
+    system("clear");
+#endif
+}
+
+Bool Application::isAssignment(const Line & line) const {
+    return memchr(line.first, '=', line.second - line.first) != EXPRESSIO_NULL;
+}
+Bool Application::isUInt(const std::string & string) const {
+    UInt type;
+    std::stringstream sstream(string);
+
+    sstream >> std::noskipws >> type;
+
+    return sstream && sstream.eof();
+}
+void Application::format(const Expression & expression, std::string & output) const {
+    Character number[EXPRESSIO_MAX_FORMAT_LENGTH];
+
+    if (expression.error.type == ErrorContent::None) {
+        const Result & variable = expression.output;
+
+        if (variable.isOutput) {
+            output += variable.name;
+            output += " = ";
+        }
+
+        output.append(number, snprintf(number, sizeof(number), "%.5f", variable.value));
+    }
+    else {
+        output.append(number, snprintf(number, sizeof(number), "%llu: ",
+            (unsigned long long)expression.error.position));
+
+        switch (expression.error.type) {
+        case ErrorContent::UnknownSymbol:
+            output += translator.UNKNOWN_SYMBOL_ERROR;
+            break;
+        case ErrorContent::InvalidExpression:
+            output += translator.INVALID_EXPRESSION_ERROR;
+            break;
+        case ErrorContent::UndefinedVariable:
+            output += translator.UNDEFINED_VARIABLE_ERROR;
+            break;
+        case ErrorContent::DivisionByZero:
+            output += translator.DIVISION_BY_ZERO_ERROR;
+            break;
+        case ErrorContent::DepthLimitExceeded:
+            output += translator.DEPTH_LIMIT_ERROR;
+            break;
+        default:
+            break;
+        }
+    }
+
+    output += '\n';
+}
+const Character * Application::evaluateLines(const Character * begin,
+    const Character * end, std::string & output, ThreadPool * pool) {
+    std::vector<Line> lines;
+    const Character * newline;
+
+    while ((newline = (const Character *)memchr(begin, '\n', end - begin)) != EXPRESSIO_NULL) {
+        if (pool == EXPRESSIO_NULL)
+            evaluateLine(begin, newline, output);
+        else {
+            lines.push_back(Line(begin, newline));
+
+            if (lines.size() == EXPRESSIO_PARALLEL_BLOCK_SIZE) {
+                evaluateBlock(lines, output, *pool);
+                lines.clear();
+            }
+        }
+
+        begin = newline + 1;
+
+        if (output.size() >= EXPRESSIO_STREAM_BUFFER_SIZE) {
+            fwrite(output.data(), 1, output.size(), stdout);
+            output.clear();
+        }
+    }
+
+    if (!lines.empty())
+        evaluateBlock(lines, output, *pool);
+
+    return begin;
+}
+void Application::evaluateBlock(const std::vector<Line> & lines, std::string & output,
+    ThreadPool & pool) {
+    UInt i = 0;
+
+    while (i < lines.size()) {
+        UInt j = i;
+
+        while (j < lines.size() && !isAssignment(lines[j]))
+            j++;
+
+        if (j - i < EXPRESSIO_PARALLEL_CHUNK_SIZE) {
+            for (; i < j; i++)
+                evaluateLine(lines[i].first, lines[i].second, output);
+        }
+        else {
+            UInt first = i;
+            UInt chunkCount = (j - i + EXPRESSIO_PARALLEL_CHUNK_SIZE - 1)
+                / EXPRESSIO_PARALLEL_CHUNK_SIZE;
+            std::vector<std::string> results(chunkCount);
+            std::vector<Interpreter::Statistics> statistics(chunkCount);
+
+            Tracer::Scope scope(tracer.get(), "block", "batch");
+
+            pool.run(chunkCount, [&](UInt chunk) {
+                Tracer::Scope scope(tracer.get(), "chunk", "batch");
+                UInt k = first + chunk * EXPRESSIO_PARALLEL_CHUNK_SIZE;
+                UInt last = std::min(k + EXPRESSIO_PARALLEL_CHUNK_SIZE, j);
+
+                for (; k < last; k++) {
+                    const Character * lineBegin = lines[k].first;
+                    const Character * lineEnd = lines[k].second;
+
+                    if (lineBegin != lineEnd && *(lineEnd - 1) == '\r')
+                        lineEnd--;
+
+                    format(interpreter.evaluate(lineBegin, lineEnd - lineBegin, &statistics[chunk]),
+                        results[chunk]);
+                }
+            });
+
+            for (UInt chunk = 0; chunk < chunkCount; chunk++) {
+                interpreter.mergeStatistics(statistics[chunk]);
+                output += results[chunk];
+
+                if (output.size() >= EXPRESSIO_STREAM_BUFFER_SIZE) {
+                    fwrite(output.data(), 1, output.size(), stdout);
+                    output.clear();
+                }
+            }
+
+            i = j;
+        }
+
+        if (i < lines.size())
+            evaluateLine(lines[i].first, lines[i].second, output);
+
+        i++;
+    }
+}
+void Application::evaluateLine(const Character * begin, const Character * end,
+    std::string & output) {
+    if (begin != end && *(end - 1) == '\r')
+        end--;
+
+    format(interpreter.run(begin, end - begin), output);
+}
+
+void Application::editorAction() {
+    clear();
+
+    createTitle();
+    separator();
+
+    print(translator.EDITOR);
+    separator();
+
+    print(translator.EDITOR_MESSAGE);
+    separator();
+
+    if (!historyList.isEmpty()) {
+        Queue<std::string>::Iterator it(historyList.getBegin());
+
+        while (it != historyList.getEnd())
+            print(*it++);
+
+        separator();
+    }
+
+    std::string source, result;
+
+    do {
+        requestText(source);
+        historyList.insert(source);
+
+        Expression expression = interpreter.run(source);
+
+        if (expression.error.type == ErrorContent::None) {
+            Result variable = expression.output;
+
+            result = ">> ";
+
+            if (variable.isOutput)
+                result += variable.name + " = ";
+
+            std::stringstream sstream;
+            sstream << std::fixed << std::setprecision(5) << variable.value;
+
+            result += sstream.str();
+        }
+        else {
+            result += std::string(expression.error.position, ' ');
+            result += "^\n>> ";
+
+            switch (expression.error.type) {
+            case ErrorContent::UnknownSymbol:
+                result += translator.UNKNOWN_SYMBOL_ERROR;
+                break;
+            case ErrorContent::InvalidExpression:
+                result += translator.INVALID_EXPRESSION_ERROR;
+                break;
+            case ErrorContent::UndefinedVariable:
+                result += translator.UNDEFINED_VARIABLE_ERROR;
+                break;
+            case ErrorContent::DivisionByZero:
+                result += translator.DIVISION_BY_ZERO_ERROR;
+                break;
+            case ErrorContent::DepthLimitExceeded:
+                result += translator.DEPTH_LIMIT_ERROR;
+                break;
+            default:
+                break;
+            }
+        }
+
+        historyList.insert(result);
+
+        print(result);
+        separator();
+
+        result.clear();
+
+        Queue<std::string> menu;
+        menu.insert(translator.CONTINUE);
+        menu.insert(translator.CANCEL);
+        menu.insert(translator.EXIT);
+
+        createMenu(menu);
+        separator();
+
+        requestOption();
+        separator();
+    } while (option == 1);
+
+    switch (option) {
+    case 2:
+        execute();
+        break;
+    case 3:
+        exitAction();
+        break;
+    default:
+        editorAction();
+    }
+}
+void Application::clearAction() {
+    clear();
+
+    createTitle();
+    separator();
+
+    print(translator.CLEAR);
+    separator();
+
+    print(translator.CLEAR_MESSAGE);
+    separator();
+
+    Queue<std::string> menu;
+    menu.insert(translator.YES);
+    menu.insert(translator.NO);
+    menu.insert(translator.EXIT);
+
+    createMenu(menu);
+    separator();
+
+    requestOption();
+    separator();
+
+    switch (option) {
+    case 1:
+        historyList.clear();
+        interpreter.clear();
+
+        execute();
+
+        break;
+    case 2:
+        execute();
+        break;
+    case 3:
+        exitAction();
+        break;
+    default:
+        clearAction();
+    }
+}
+void Application::exportAction() {
+    clear();
+
+    createTitle();
+    separator();
+
+    print(translator.EXPORT);
+    separator();
+
+    print(translator.EXPORT_MESSAGE);
+
+    std::string filename;
+    std::fstream file;
+
+    requestText(filename);
+    separator();
+
+    Queue<std::string> menu;
+    menu.insert(translator.EXPORT);
+    menu.insert(translator.CANCEL);
+    menu.insert(translator.EXIT);
+
+    createMenu(menu);
+    separator();
+
+    requestOption();
+    separator();
+
+    switch (option) {
+    case 1:
+        file.open(filename, std::fstream::out);
+
+        if (file.is_open()) {
+            Queue<std::string>::Iterator it(historyList.getBegin());
+
+            while (it != historyList.getEnd())
+                file << *it++ << std::endl;
+
+            file.close();
+
+            execute();
+        }
+        else
+            exportAction();
+
+        break;
+    case 2:
+        execute();
+        break;
+    case 3:
+        exitAction();
+        break;
+    default:
+        exportAction();
+    }
+}
+void Application::preferencesAction() {
+    clear();
+
+    createTitle();
+    separator();
+
+    print(translator.PREFERENCES);
+    separator();
+
+    print(translator.LANGUAGE_MESSAGE);
+    separator();
+
+    Queue<std::string> menu;
+    menu.insert(translator.ENGLISH);
+    menu.insert(translator.PORTUGUESE);
+    menu.insert(translator.DEFAULT);
+
+    createMenu(menu);
+    separator();
+
+    requestOption();
+    separator();
+
+    if (option < 1 || option > menu.getSize())
+        preferencesAction();
+
+    preferences.language = (Translator::Language)(option - 1);
+
+#ifdef _WIN64
+    print(translator.THEME_MESSAGE);
+    separator();
+
+    menu.clear();
+    menu.insert(translator.LIGHT);
+    menu.insert(translator.DARK);
+    menu.insert(translator.DEFAULT);
+
+    createMenu(menu);
+    separator();
+
+    requestOption();
+    separator();
+
+    if (option < 1 || option > menu.getSize())
+        preferencesAction();
+
+    preferences.theme = (Theme)(option - 1);
+#endif
+
+    menu.clear();
+    menu.insert(translator.SAVE);
+    menu.insert(translator.CANCEL);
+    menu.insert(translator.EXIT);
+
+    createMenu(menu);
+    separator();
+
+    requestOption();
+
+    switch (option) {
+    case 1:
+        savePreferences();
+
+        if (preferences.language != translator.getLanguage()) {
+            historyList.clear();
+            interpreter.clear();
+        }
+
+        translator.setLanguage(preferences.language);
+        interpreter.setDecimalSeparator(translator.DECIMAL_SEPARATOR);
+
+#ifdef _WIN64
+        setTheme(preferences.theme);
+#endif
+
+        execute();
+
+        break;
+    case 2:
+        execute();
+        break;
+    case 3:
+        exitAction();
+        break;
+    default:
+        preferencesAction();
+    }
+}
+void Application::aboutAction() {
+    clear();
+
+    createTitle();
+    separator();
+
+    print(translator.ABOUT);
+    separator();
+
+    print(translator.ABOUT_MESSAGE);
+    separator();
+
+    print(translator.COPYRIGHT_MESSAGE);
+    print(translator.LICENSE_MESSAGE);
+    separator();
+
+    Queue<std::string> menu;
+    menu.insert(translator.OK);
+    menu.insert(translator.EXIT);
+
+    createMenu(menu);
+    separator();
+
+    requestOption();
+    separator();
+
+    switch (option) {
+    case 1:
+        execute();
+        break;
+    case 2:
+        exitAction();
+        break;
+    default:
+        aboutAction();
+    }
+}
+void Application::exitAction() {
+    clear();
+
+    createTitle();
+    separator();
+
+    print(translator.EXIT);
+    separator();
+
+    print(translator.EXIT_MESSAGE);
+    separator();
+
+    Queue<std::string> menu;
+    menu.insert(translator.YES);
+    menu.insert(translator.NO);
+
+    createMenu(menu);
+    separator();
+
+    requestOption();
+    separator();
+
+    switch (option) {
+    case 1:
+        return;
+        break;
+    case 2:
+        execute();
+        break;
+    default:
+        exitAction();
+    }
+}
+
 EXPRESSIO_NAMESPACE_END
\ No newline at end of file
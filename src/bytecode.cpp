@@ -0,0 +1,336 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "bytecode.h"
+#include "kernel.h"
+#include <algorithm>
+#include <cmath>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+Bytecode::Operand::Operand() : kind(Register), index(0) {}
+Bytecode::Operand::Operand(Kind kind, UInt index) : kind(kind), index(index) {}
+Bytecode::Operand::~Operand() {}
+
+Bytecode::Instruction::Instruction() : code(Add), target(0), position(0) {}
+Bytecode::Instruction::Instruction(OpCode code, UInt target, const Operand & lhs,
+    const Operand & rhs, UInt position)
+    : code(code), target(target), lhs(lhs), rhs(rhs), position(position) {}
+Bytecode::Instruction::~Instruction() {}
+
+Bytecode::Parameter::Parameter() : position(0), checkpoint(0) {}
+Bytecode::Parameter::Parameter(const std::string & name, UInt position, UInt checkpoint)
+    : name(name), position(position), checkpoint(checkpoint) {}
+Bytecode::Parameter::~Parameter() {}
+
+Bytecode::Bytecode() : registerCount(0) {}
+Bytecode::~Bytecode() {}
+
+Bytecode & Bytecode::lower(const SyntaxTree & tree) {
+    clear();
+
+    if (tree.isEmpty())
+        return *this;
+
+    operands.assign(tree.getSize(), Operand());
+    names.assign(tree.getNameCount(), tree.getSize());
+
+    for (Index i = 0; i <= tree.getRoot(); i++) {
+        const SyntaxTree::Node & node = tree.getNode(i);
+
+        if (node.type == Symbol::Variable) {
+            if (names[node.name] == tree.getSize()) {
+                names[node.name] = parameters.size();
+
+                parameters.push_back(Parameter(tree.getName(node.name), node.position,
+                    instructions.size()));
+            }
+
+            operands[i] = Operand(Operand::Variable, names[node.name]);
+        }
+        else if (node.type == Symbol::Number) {
+            constants.push_back(node.value);
+            operands[i] = Operand(Operand::Constant, constants.size() - 1);
+        }
+        else {
+            OpCode code;
+
+            switch (node.type) {
+            case Symbol::Addition:
+                code = Add;
+                break;
+            case Symbol::Subtraction:
+                code = Subtract;
+                break;
+            case Symbol::Multiplication:
+                code = Multiply;
+                break;
+            case Symbol::Division:
+                code = Divide;
+                break;
+            case Symbol::Exponentiation:
+                code = Power;
+                break;
+            default:
+                code = Modulo;
+            }
+
+            operands[i] = Operand(Operand::Register, instructions.size());
+            instructions.push_back(Instruction(code, operands[i].index, operands[node.left],
+                operands[node.right], node.position));
+        }
+    }
+
+    result = operands[tree.getRoot()];
+
+    allocate();
+
+    return *this;
+}
+Bytecode & Bytecode::clear() {
+    instructions.clear();
+    constants.clear();
+    parameters.clear();
+    result = Operand();
+    registerCount = 0;
+
+    return *this;
+}
+Bool Bytecode::run(const Float * variables, Float * registers,
+    Float & value, UInt & position) const {
+    return run(variables, registers, instructions.size(), value, position);
+}
+Bool Bytecode::run(const Float * variables, Float * registers, UInt limit,
+    Float & value, UInt & position) const {
+    const Float * banks[] = { registers, constants.data(), variables };
+
+    const Instruction * instruction = instructions.data();
+    const Instruction * end = instruction + limit;
+
+    for (; instruction != end; instruction++) {
+        Float lhs = banks[instruction->lhs.kind][instruction->lhs.index];
+        Float rhs = banks[instruction->rhs.kind][instruction->rhs.index];
+
+        switch (instruction->code) {
+        case Add:
+            registers[instruction->target] = lhs + rhs;
+            break;
+        case Subtract:
+            registers[instruction->target] = lhs - rhs;
+            break;
+        case Multiply:
+            registers[instruction->target] = lhs * rhs;
+            break;
+        case Divide:
+            if (rhs == 0) {
+                position = instruction->position + 1;
+
+                return false;
+            }
+
+            registers[instruction->target] = lhs / rhs;
+            break;
+        case Power:
+            registers[instruction->target] = std::pow(lhs, rhs);
+            break;
+        case Modulo:
+            registers[instruction->target] = std::fmod(lhs, rhs);
+            break;
+        }
+    }
+
+    if (limit == instructions.size())
+        value = banks[result.kind][result.index];
+
+    return true;
+}
+Bool Bytecode::run(const Float * const * columns, UInt rows, Float * output,
+    const Kernel & kernel, UInt & position) const {
+    return run(columns, rows, output, kernel, instructions.size(), position);
+}
+Bool Bytecode::run(const Float * const * columns, UInt rows, Float * output,
+    const Kernel & kernel, UInt limit, UInt & position) const {
+    const UInt tileSize = EXPRESSIO_BATCH_TILE_SIZE;
+
+    thread_local std::vector<Float> constantTiles;
+    thread_local std::vector<Float> registerTiles;
+
+    constantTiles.resize(constants.size() * tileSize);
+    registerTiles.resize(registerCount * tileSize);
+
+    for (UInt i = 0; i < constants.size(); i++)
+        std::fill_n(constantTiles.begin() + i * tileSize, tileSize, constants[i]);
+
+    Bool valid = true;
+
+    for (UInt row = 0; row < rows; row += tileSize) {
+        UInt count = std::min(tileSize, rows - row);
+
+        const Float * banks[] = { registerTiles.data(), constantTiles.data() };
+        const Float * operands[2];
+
+        for (UInt i = 0; i < limit; i++) {
+            const Instruction & instruction = instructions[i];
+            const Operand * sources[] = { &instruction.lhs, &instruction.rhs };
+
+            for (UInt j = 0; j < 2; j++) {
+                if (sources[j]->kind == Operand::Variable)
+                    operands[j] = columns[sources[j]->index] + row;
+                else
+                    operands[j] = banks[sources[j]->kind] + sources[j]->index * tileSize;
+            }
+
+            Float * target = i + 1 == instructions.size() ? output + row :
+                registerTiles.data() + instruction.target * tileSize;
+
+            if (!kernel.getFunction(instruction.code)(operands[0], operands[1],
+                target, count) && valid) {
+                valid = false;
+                position = instruction.position + 1;
+            }
+        }
+
+        if (limit != instructions.size())
+            continue;
+
+        if (result.kind == Operand::Variable && columns[result.index] != EXPRESSIO_NULL)
+            std::copy_n(columns[result.index] + row, count, output + row);
+        else if (result.kind == Operand::Constant)
+            std::fill_n(output + row, count, constants[result.index]);
+    }
+
+    return valid;
+}
+
+UInt Bytecode::getRegisterCount() const {
+    return registerCount;
+}
+UInt Bytecode::getInstructionCount() const {
+    return instructions.size();
+}
+UInt Bytecode::getConstantCount() const {
+    return constants.size();
+}
+UInt Bytecode::getParameterCount() const {
+    return parameters.size();
+}
+const Bytecode::Instruction & Bytecode::getInstruction(UInt index) const {
+    return instructions[index];
+}
+Float Bytecode::getConstant(UInt index) const {
+    return constants[index];
+}
+const Bytecode::Parameter & Bytecode::getParameter(UInt index) const {
+    return parameters[index];
+}
+const Bytecode::Operand & Bytecode::getResult() const {
+    return result;
+}
+UInt Bytecode::getMemoryUsage() const {
+    UInt size = instructions.capacity() * sizeof(Instruction)
+        + constants.capacity() * sizeof(Float)
+        + parameters.capacity() * sizeof(Parameter)
+        + operands.capacity() * sizeof(Operand)
+        + (names.capacity() + lastUse.capacity() + physical.capacity() + available.capacity())
+        * sizeof(UInt);
+
+    for (UInt i = 0; i < parameters.size(); i++)
+        size += parameters[i].name.capacity();
+
+    return size;
+}
+Bool Bytecode::findParameter(const std::string & name, UInt & index) const {
+    for (UInt i = 0; i < parameters.size(); i++) {
+        if (parameters[i].name == name) {
+            index = i;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void Bytecode::allocate() {
+    UInt count = instructions.size();
+
+    lastUse.assign(count, count);
+    physical.assign(count, 0);
+    available.clear();
+
+    for (UInt i = 0; i < count; i++) {
+        const Instruction & instruction = instructions[i];
+
+        if (instruction.lhs.kind == Operand::Register)
+            lastUse[instruction.lhs.index] = i;
+
+        if (instruction.rhs.kind == Operand::Register)
+            lastUse[instruction.rhs.index] = i;
+    }
+
+    if (result.kind == Operand::Register)
+        lastUse[result.index] = count;
+
+    registerCount = 0;
+
+    for (UInt i = 0; i < count; i++) {
+        Instruction & instruction = instructions[i];
+
+        Bool isLhsRegister = instruction.lhs.kind == Operand::Register;
+        Bool isRhsRegister = instruction.rhs.kind == Operand::Register;
+        UInt lhs = instruction.lhs.index;
+        UInt rhs = instruction.rhs.index;
+
+        if (isLhsRegister) {
+            instruction.lhs.index = physical[lhs];
+
+            if (lastUse[lhs] == i)
+                available.push_back(physical[lhs]);
+        }
+
+        if (isRhsRegister) {
+            instruction.rhs.index = physical[rhs];
+
+            if (lastUse[rhs] == i && !(isLhsRegister && lhs == rhs))
+                available.push_back(physical[rhs]);
+        }
+
+        if (available.empty())
+            physical[i] = registerCount++;
+        else {
+            physical[i] = available.back();
+            available.pop_back();
+        }
+
+        instruction.target = physical[i];
+    }
+
+    if (result.kind == Operand::Register)
+        result.index = physical[result.index];
+}
+
+EXPRESSIO_NAMESPACE_END
\ No newline at end of file
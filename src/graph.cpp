@@ -0,0 +1,156 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "graph.h"
+#include <algorithm>
+#include <utility>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+DependencyGraph::DependencyGraph() {}
+DependencyGraph::~DependencyGraph() {}
+
+UInt DependencyGraph::getSize() const {
+    return dependencies.size();
+}
+const std::vector<UInt> & DependencyGraph::getDependencies(UInt node) const {
+    return dependencies[node];
+}
+const std::vector<UInt> & DependencyGraph::getDependents(UInt node) const {
+    return dependents[node];
+}
+Bool DependencyGraph::isReachable(UInt source, UInt target) const {
+    if (source == target)
+        return true;
+
+    if (source >= dependents.size())
+        return false;
+
+    std::vector<Bool> visited(dependents.size(), false);
+    std::vector<UInt> stack(1, source);
+
+    visited[source] = true;
+
+    while (!stack.empty()) {
+        UInt node = stack.back();
+        stack.pop_back();
+
+        for (UInt i = 0; i < dependents[node].size(); i++) {
+            UInt next = dependents[node][i];
+
+            if (next == target)
+                return true;
+
+            if (!visited[next]) {
+                visited[next] = true;
+                stack.push_back(next);
+            }
+        }
+    }
+
+    return false;
+}
+void DependencyGraph::sort(UInt source, std::vector<UInt> & order) const {
+    order.clear();
+
+    if (source >= dependents.size())
+        return;
+
+    std::vector<Bool> visited(dependents.size(), false);
+    std::vector<std::pair<UInt, UInt> > stack(1, std::make_pair(source, (UInt)0));
+
+    visited[source] = true;
+
+    while (!stack.empty()) {
+        std::pair<UInt, UInt> & frame = stack.back();
+        const std::vector<UInt> & edges = dependents[frame.first];
+
+        if (frame.second < edges.size()) {
+            UInt next = edges[frame.second++];
+
+            if (!visited[next]) {
+                visited[next] = true;
+                stack.push_back(std::make_pair(next, (UInt)0));
+            }
+        }
+        else {
+            order.push_back(frame.first);
+            stack.pop_back();
+        }
+    }
+
+    order.pop_back();
+    std::reverse(order.begin(), order.end());
+}
+
+Bool DependencyGraph::define(UInt node, const std::vector<UInt> & edges) {
+    remove(node);
+
+    for (UInt i = 0; i < edges.size(); i++) {
+        if (isReachable(node, edges[i]))
+            return false;
+    }
+
+    reserve(node);
+
+    for (UInt i = 0; i < edges.size(); i++) {
+        reserve(edges[i]);
+
+        dependencies[node].push_back(edges[i]);
+        dependents[edges[i]].push_back(node);
+    }
+
+    return true;
+}
+DependencyGraph & DependencyGraph::remove(UInt node) {
+    if (node >= dependencies.size())
+        return *this;
+
+    for (UInt i = 0; i < dependencies[node].size(); i++) {
+        std::vector<UInt> & edges = dependents[dependencies[node][i]];
+        edges.erase(std::find(edges.begin(), edges.end(), node));
+    }
+
+    dependencies[node].clear();
+
+    return *this;
+}
+DependencyGraph & DependencyGraph::clear() {
+    dependencies.clear();
+    dependents.clear();
+
+    return *this;
+}
+
+void DependencyGraph::reserve(UInt node) {
+    if (node >= dependencies.size()) {
+        dependencies.resize(node + 1);
+        dependents.resize(node + 1);
+    }
+}
+
+EXPRESSIO_NAMESPACE_END
\ No newline at end of file
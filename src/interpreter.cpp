@@ -1,455 +1,1117 @@
-// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
-//
-// Redistribution and use in source and binary forms, with or without
-// modification, are permitted provided that the following conditions are met:
-//
-// * Redistributions of source code must retain the above copyright notice, this
-//   list of conditions and the following disclaimer.
-//
-// * Redistributions in binary form must reproduce the above copyright notice,
-//   this list of conditions and the following disclaimer in the documentation
-//   and/or other materials provided with the distribution.
-//
-// * Neither the name of the copyright holder nor the names of its
-//   contributors may be used to endorse or promote products derived from
-//   this software without specific prior written permission.
-//
-// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
-// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
-// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
-// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
-// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
-// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
-// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
-// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
-// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
-// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
-
-#include "interpreter.h"
-#include <cctype>
-
-EXPRESSIO_NAMESPACE_BEGIN
-
-ErrorContent::ErrorContent() : type(None), position(0) {}
-ErrorContent::ErrorContent(Type type, UInt position)
-    : type(type), position(position) {}
-ErrorContent::~ErrorContent() {}
-
-Expression::Expression() : error(ErrorContent::None) {}
-Expression::Expression(Result output, ErrorContent error)
-    : output(output), error(error) {}
-Expression::~Expression() {}
-
-Interpreter::Interpreter() {}
-Interpreter::~Interpreter() {}
-
-Expression Interpreter::run(const std::string & source) {
-    Expression expression;
-
-    TokenStream tokens;
-    expression.error = tokenize(source, tokens);
-
-    if (expression.error.type != ErrorContent::None) {
-        deleteTokens(tokens);
-
-        return expression;
-    }
-
-    AbstractSyntaxTree ast;
-    expression.error = parse(tokens, ast);
-
-    if (expression.error.type != ErrorContent::None) {
-        deleteTokens(tokens);
-
-        return expression;
-    }
-
-    SymbolPointer result = EXPRESSIO_NULL;
-    expression.error = evaluate(ast.getRoot(), result);
-
-    if (expression.error.type != ErrorContent::None) {
-        deleteTokens(tokens);
-
-        if (result != EXPRESSIO_NULL)
-            delete result;
-
-        return expression;
-    }
-
-    if (result->type == Symbol::Variable) {
-        VariableSymbol * variableSymbol = (VariableSymbol *)result;
-
-        VariableTable::Iterator it(variableTable.getBegin());
-        Bool find = false;
-
-        while (it != variableTable.getEnd()) {
-            if (it->name == variableSymbol->name) {
-                find = true;
-                it->value = variableSymbol->value;
-
-                break;
-            }
-
-            it++;
-        }
-
-        if (!find)
-            variableTable.insert(*variableSymbol);
-
-        variableSymbol->isOutput = true;
-        expression.output = *variableSymbol;
-    }
-    else
-        expression.output = Result("", ((NumberSymbol *)result)->value);
-
-    delete result;
-
-    deleteTokens(tokens);
-
-    return expression;
-}
-Interpreter & Interpreter::setTranslator(Translator * translator) {
-    this->translator = translator;
-
-    return *this;
-}
-VariableTable Interpreter::getVariableTable() const {
-    return variableTable;
-}
-Interpreter & Interpreter::clear() {
-    variableTable.clear();
-
-    return *this;
-}
-
-ErrorContent Interpreter::tokenize(const std::string & source,
-    TokenStream & tokens) const {
-    UInt i;
-
-    for (i = 0; i < source.length(); i++) {
-        Character c = source[i];
-
-        if (c < -1 || c > 255)
-            return ErrorContent(ErrorContent::UnknownSymbol, i);
-
-        if (std::isspace(c))
-            continue;
-
-        UInt s;
-
-        if (isVariable(source.substr(i), s)) {
-            tokens.insert(new VariableSymbol(source.substr(i, s), 0, i));
-            i += s - 1;
-        }
-        else if (isNumber(source.substr(i), s)) {
-            tokens.insert(new NumberSymbol(std::stod(source.substr(i, s)), i));
-            i += s - 1;
-        }
-        else {
-            switch (c) {
-            case '+':
-                tokens.insert(new AdditionSymbol(i));
-                break;
-            case '-':
-                tokens.insert(new SubtractionSymbol(i));
-                break;
-            case '*':
-                tokens.insert(new MultiplicationSymbol(i));
-                break;
-            case '/':
-                tokens.insert(new DivisionSymbol(i));
-                break;
-            case '^':
-                tokens.insert(new ExponentiationSymbol(i));
-                break;
-            case '%':
-                tokens.insert(new ModuloSymbol(i));
-                break;
-            case '=':
-                tokens.insert(new AssignmentSymbol(i));
-                break;
-            case '(':
-                tokens.insert(new LParenthesisSymbol(i));
-                break;
-            case ')':
-                tokens.insert(new RParenthesisSymbol(i));
-                break;
-            default:
-                return ErrorContent(ErrorContent::UnknownSymbol, i);
-            }
-        }
-    }
-
-    tokens.insert(new EOFSymbol(i));
-
-    return ErrorContent(ErrorContent::None);
-}
-ErrorContent Interpreter::parse(const TokenStream & tokens,
-    AbstractSyntaxTree & ast) const {
-    TokenStream::ConstIterator token(tokens.getBegin());
-    ErrorContent error;
-
-    AbstractSyntaxTree::NodePointer node = definition(token, error);
-    ast.setRoot(node);
-
-    if (error.type != ErrorContent::None) {
-        ast.clear();
-
-        token = tokens.getBegin();
-        error = ErrorContent(ErrorContent::None);
-
-        node = expression(token, error);
-
-        if ((*token)->type != Symbol::EndOfFile)
-            error = ErrorContent(ErrorContent::InvalidExpression, (*token)->position);
-
-        ast.setRoot(node);
-    }
-
-    return error;
-}
-ErrorContent Interpreter::evaluate(AbstractSyntaxTree::NodePointer node,
-    SymbolPointer & result) {
-    if (node == EXPRESSIO_NULL)
-        return ErrorContent(ErrorContent::InvalidExpression);
-
-    if (node->left == EXPRESSIO_NULL && node->right == EXPRESSIO_NULL) {
-        SymbolPointer symbol = node->data;
-
-        if (symbol->type == Symbol::Variable) {
-            VariableSymbol * variableSymbol = (VariableSymbol *)symbol;
-
-            VariableTable::Iterator it(variableTable.getBegin());
-            Bool find = false;
-
-            while (it != variableTable.getEnd()) {
-                if (it->name == variableSymbol->name) {
-                    find = true;
-                    result = new NumberSymbol(it->value, variableSymbol->position);
-
-                    break;
-                }
-
-                it++;
-            }
-
-            if (!find)
-                return ErrorContent(ErrorContent::UndefinedVariable, variableSymbol->position);
-        }
-        else if (symbol->type == Symbol::Number) {
-            NumberSymbol * numberSymbol = (NumberSymbol *)symbol;
-            result = new NumberSymbol(numberSymbol->value, numberSymbol->position);
-        }
-        else
-            return ErrorContent(ErrorContent::InvalidExpression);
-    }
-    else {
-        OperatorSymbol * operatorSymbol = (OperatorSymbol *)node->data;
-
-        ErrorContent error;
-        SymbolPointer lhs, rhs;
-
-        if (operatorSymbol->type == Symbol::Assignment) {
-            VariableSymbol * variableSymbol = (VariableSymbol *)node->left->data;
-            lhs = new VariableSymbol(variableSymbol->name, 0, variableSymbol->position);
-        }
-        else {
-            error = evaluate(node->left, lhs);
-
-            if (error.type != ErrorContent::None)
-                return error;
-        }
-
-        error = evaluate(node->right, rhs);
-
-        if (error.type != ErrorContent::None) {
-            delete lhs;
-
-            return error;
-        }
-
-        if (operatorSymbol->type == Symbol::Division && rhs->type == Symbol::Number) {
-            if (((NumberSymbol *)rhs)->value == 0) {
-                delete lhs, rhs;
-
-                return ErrorContent(ErrorContent::DivisionByZero, operatorSymbol->position + 1);
-            }
-        }
-
-        result = operatorSymbol->compute(lhs, rhs);
-
-        delete lhs, rhs;
-    }
-
-    return ErrorContent(ErrorContent::None);
-}
-
-void Interpreter::deleteTokens(TokenStream & tokens) const {
-    TokenStream::Iterator it(tokens.getBegin());
-
-    while (it != tokens.getEnd()) {
-        if (*it != EXPRESSIO_NULL)
-            delete *it;
-
-        it++;
-    }
-
-    tokens.clear();
-}
-Bool Interpreter::isVariable(const std::string & string, UInt & size) const {
-    std::string::const_iterator c(string.begin());
-
-    if (!std::isalpha(*c))
-        return false;
-
-    while (c != string.end() && std::isalpha(*c))
-        c++;
-
-    size = c - string.begin();
-
-    return true;
-}
-Bool Interpreter::isNumber(const std::string & string, UInt & size) const {
-    std::string::const_iterator c(string.begin());
-
-    if (!std::isdigit(*c))
-        return false;
-
-    while (c != string.end() && std::isdigit(*c))
-        c++;
-
-    if (c != string.end() && *c == translator->DECIMAL_SEPARATOR) {
-        if (++c == string.end())
-            return false;
-
-        if (!std::isdigit(*c))
-            return false;
-
-        while (c != string.end() && std::isdigit(*c))
-            c++;
-    }
-
-    if (c != string.end() && *c == 'e') {
-        if (++c == string.end())
-            return false;
-
-        if (*c == '+' || *c == '-') {
-            if (++c == string.end())
-                return false;
-        }
-
-        if (!std::isdigit(*c))
-            return false;
-
-        while (c != string.end() && std::isdigit(*c))
-            c++;
-    }
-
-    size = c - string.begin();
-
-    return true;
-}
-
-AbstractSyntaxTree::NodePointer Interpreter::literal(TokenStream::ConstIterator & token,
-    ErrorContent & error) const {
-    if ((*token)->type == Symbol::Variable || (*token)->type == Symbol::Number)
-        return new AbstractSyntaxTree::Node(*token++);
-    else if ((*token)->type == Symbol::LParenthesis) {
-        AbstractSyntaxTree::NodePointer expr = expression(++token, error);
-
-        if (error.type != ErrorContent::None)
-            return expr;
-
-        if ((*token)->type == Symbol::RParenthesis) {
-            token++;
-
-            return expr;
-        }
-    }
-
-    error = ErrorContent(ErrorContent::InvalidExpression, (*token)->position);
-
-    return EXPRESSIO_NULL;
-}
-AbstractSyntaxTree::NodePointer Interpreter::factor(TokenStream::ConstIterator & token,
-    ErrorContent & error) const {
-    AbstractSyntaxTree::NodePointer node = literal(token, error);
-
-    if (error.type != ErrorContent::None)
-        return node;
-
-    while ((*token)->type == Symbol::Exponentiation) {
-        node = new AbstractSyntaxTree::Node(*token++, node);
-        node->right = literal(token, error);
-
-        if (error.type != ErrorContent::None)
-            return node;
-    }
-
-    return node;
-}
-AbstractSyntaxTree::NodePointer Interpreter::term(TokenStream::ConstIterator & token,
-    ErrorContent & error) const {
-    AbstractSyntaxTree::NodePointer node = factor(token, error);
-
-    if (error.type != ErrorContent::None)
-        return node;
-
-    while ((*token)->type == Symbol::Multiplication || (*token)->type == Symbol::Division
-        || (*token)->type == Symbol::Modulo) {
-        node = new AbstractSyntaxTree::Node(*token++, node);
-        node->right = factor(token, error);
-
-        if (error.type != ErrorContent::None)
-            return node;
-    }
-
-    return node;
-}
-AbstractSyntaxTree::NodePointer Interpreter::expression(TokenStream::ConstIterator & token,
-    ErrorContent & error) const {
-    AbstractSyntaxTree::NodePointer node = term(token, error);
-
-    if (error.type != ErrorContent::None)
-        return node;
-
-    while ((*token)->type == Symbol::Addition || (*token)->type == Symbol::Subtraction) {
-        node = new AbstractSyntaxTree::Node(*token++, node);
-        node->right = term(token, error);
-
-        if (error.type != ErrorContent::None)
-            return node;
-    }
-
-    return node;
-}
-AbstractSyntaxTree::NodePointer Interpreter::definition(TokenStream::ConstIterator & token,
-    ErrorContent & error) const {
-    if ((*token)->type != Symbol::Variable) {
-        error = ErrorContent(ErrorContent::InvalidExpression, (*token)->position);
-
-        return EXPRESSIO_NULL;
-    }
-
-    AbstractSyntaxTree::NodePointer node = new AbstractSyntaxTree::Node;
-    node->left = new AbstractSyntaxTree::Node(*token++);
-
-    if ((*token)->type != Symbol::Assignment) {
-        error = ErrorContent(ErrorContent::InvalidExpression, (*token)->position);
-
-        return node;
-    }
-
-    node->data = *token++;
-
-    AbstractSyntaxTree::NodePointer expr = expression(token, error);
-
-    if (error.type != ErrorContent::None)
-        return node;
-
-    node->right = expr;
-
-    return node;
-}
-
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "interpreter.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <clocale>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+
+ErrorContent::ErrorContent() : type(None), position(0) {}
+ErrorContent::ErrorContent(Type type, UInt position)
+    : type(type), position(position) {}
+ErrorContent::~ErrorContent() {}
+
+Expression::Expression() : error(ErrorContent::None) {}
+Expression::Expression(Result output, ErrorContent error)
+    : output(output), error(error) {}
+Expression::~Expression() {}
+
+CompiledExpression::Program::Program() : isDefinition(false),
+    targetPosition(0), table(0), targetSlot(0), removedNodeCount(0),
+    sharedNodeCount(0), nativeThreshold(0), callCount(0), nativeCode(EXPRESSIO_NULL) {}
+CompiledExpression::Program::~Program() {}
+
+CompiledExpression::Program & CompiledExpression::Program::clear() {
+    tokens.clear();
+    tree.clear();
+    bytecode.clear();
+    error = ErrorContent(ErrorContent::None);
+
+    isDefinition = false;
+    target.clear();
+    targetPosition = 0;
+
+    table = 0;
+    slots.clear();
+    targetSlot = 0;
+
+    removedNodeCount = 0;
+    sharedNodeCount = 0;
+
+    nativeThreshold = 0;
+    callCount = 0;
+    nativeCode = EXPRESSIO_NULL;
+    native.reset();
+
+    return *this;
+}
+const NativeCode * CompiledExpression::Program::promote() const {
+    const NativeCode * code = nativeCode.load(std::memory_order_acquire);
+
+    if (code != EXPRESSIO_NULL || nativeThreshold == 0)
+        return code;
+
+    if (callCount.fetch_add(1, std::memory_order_relaxed) + 1 != nativeThreshold)
+        return EXPRESSIO_NULL;
+
+    std::unique_ptr<NativeCode> compiled(new NativeCode);
+
+    if (!compiled->compile(bytecode))
+        return EXPRESSIO_NULL;
+
+    native = std::move(compiled);
+    nativeCode.store(native.get(), std::memory_order_release);
+
+    return native.get();
+}
+
+CompiledExpression::CompiledExpression() {}
+CompiledExpression::CompiledExpression(const CompiledExpression & compiledExpression)
+    : program(compiledExpression.program) {}
+CompiledExpression::CompiledExpression(const std::shared_ptr<const Program> & program)
+    : program(program) {}
+CompiledExpression::~CompiledExpression() {}
+
+CompiledExpression & CompiledExpression::operator =(
+    const CompiledExpression & compiledExpression) {
+    program = compiledExpression.program;
+
+    return *this;
+}
+
+Bool CompiledExpression::isValid() const {
+    return program && program->error.type == ErrorContent::None;
+}
+ErrorContent CompiledExpression::getError() const {
+    if (!program)
+        return ErrorContent(ErrorContent::InvalidExpression);
+
+    return program->error;
+}
+UInt CompiledExpression::getParameterCount() const {
+    return program ? program->bytecode.getParameterCount() : 0;
+}
+std::string CompiledExpression::getParameterName(UInt index) const {
+    if (!program || index >= program->bytecode.getParameterCount())
+        return std::string();
+
+    return program->bytecode.getParameter(index).name;
+}
+UInt CompiledExpression::getRemovedNodeCount() const {
+    return program ? program->removedNodeCount : 0;
+}
+UInt CompiledExpression::getSharedNodeCount() const {
+    return program ? program->sharedNodeCount : 0;
+}
+Bool CompiledExpression::isNative() const {
+    return program && program->nativeCode.load(std::memory_order_acquire) != EXPRESSIO_NULL;
+}
+UInt CompiledExpression::getMemoryUsage() const {
+    if (!program)
+        return 0;
+
+    const NativeCode * nativeCode = program->nativeCode.load(std::memory_order_acquire);
+
+    return sizeof(Program) + program->tokens.getCapacity() * sizeof(Token)
+        + program->tree.getMemoryUsage()
+        + program->bytecode.getMemoryUsage() + program->target.capacity()
+        + program->slots.capacity() * sizeof(UInt) + program->optimizer.getMemoryUsage()
+        + program->operands.capacity() * sizeof(Index)
+        + program->operators.capacity() * sizeof(Token)
+        + (nativeCode != EXPRESSIO_NULL ? nativeCode->getSize() : 0);
+}
+Expression CompiledExpression::evaluate(const VariableTable & bindings,
+    Backend backend) const {
+    ErrorContent error = getError();
+
+    if (error.type != ErrorContent::None)
+        return Expression(Result(), error);
+
+    if (backend == TreeWalker)
+        return walk(bindings);
+
+    const Bytecode & bytecode = program->bytecode;
+    UInt count = bytecode.getParameterCount();
+
+    Float valueFile[EXPRESSIO_REGISTER_FILE_SIZE];
+    std::vector<Float> heapValues;
+    Float * values = valueFile;
+
+    if (count > EXPRESSIO_REGISTER_FILE_SIZE) {
+        heapValues.resize(count);
+        values = heapValues.data();
+    }
+
+    UInt limit = bytecode.getInstructionCount();
+    Bool isBound = program->table == bindings.getIdentity();
+
+    for (UInt i = 0; i < count; i++) {
+        const Bytecode::Parameter & parameter = bytecode.getParameter(i);
+
+        UInt slot = isBound ? program->slots[i] : 0;
+        Bool find = isBound || bindings.find(parameter.name, slot);
+
+        if (find && bindings.isDefined(slot))
+            values[i] = bindings.getValue(slot);
+        else {
+            limit = parameter.checkpoint;
+            error = ErrorContent(ErrorContent::UndefinedVariable, parameter.position);
+
+            break;
+        }
+    }
+
+    return execute(values, limit, error);
+}
+Expression CompiledExpression::evaluate(const Float * values) const {
+    ErrorContent error = getError();
+
+    if (error.type != ErrorContent::None)
+        return Expression(Result(), error);
+
+    return execute(values, program->bytecode.getInstructionCount(), error);
+}
+ErrorContent CompiledExpression::evaluate(const Float * const * columns, UInt rows,
+    Float * output, const Kernel & kernel) const {
+    ErrorContent error = getError();
+
+    if (error.type != ErrorContent::None)
+        return error;
+
+    const Bytecode & bytecode = program->bytecode;
+    UInt limit = bytecode.getInstructionCount();
+
+    for (UInt i = 0; i < bytecode.getParameterCount(); i++) {
+        const Bytecode::Parameter & parameter = bytecode.getParameter(i);
+
+        if (columns[i] == EXPRESSIO_NULL) {
+            limit = parameter.checkpoint;
+            error = ErrorContent(ErrorContent::UndefinedVariable, parameter.position);
+
+            break;
+        }
+    }
+
+    UInt position;
+
+    if (!bytecode.run(columns, rows, output, kernel, limit, position))
+        return ErrorContent(ErrorContent::DivisionByZero, position);
+
+    return error;
+}
+ErrorContent CompiledExpression::evaluate(const Float * const * columns, UInt rows,
+    Float * output, ThreadPool & threadPool, UInt chunkSize, const Kernel & kernel) const {
+    ErrorContent error = getError();
+
+    if (error.type != ErrorContent::None || rows == 0)
+        return error;
+
+    chunkSize = std::max(chunkSize, (UInt)1);
+
+    UInt count = program->bytecode.getParameterCount();
+    UInt chunkCount = (rows + chunkSize - 1) / chunkSize;
+
+    if (chunkCount == 1 || threadPool.getThreadCount() < 2)
+        return evaluate(columns, rows, output, kernel);
+
+    std::vector<ErrorContent> errors(chunkCount);
+
+    threadPool.run(chunkCount, [&](UInt chunk) {
+        UInt begin = chunk * chunkSize;
+
+        thread_local std::vector<const Float *> chunkColumns;
+
+        chunkColumns.resize(count);
+
+        for (UInt i = 0; i < count; i++)
+            chunkColumns[i] = columns[i] ? columns[i] + begin : EXPRESSIO_NULL;
+
+        errors[chunk] = evaluate(chunkColumns.data(), std::min(chunkSize, rows - begin),
+            output + begin, kernel);
+    });
+
+    for (UInt i = 0; i < chunkCount; i++) {
+        if (errors[i].type == ErrorContent::DivisionByZero)
+            return errors[i];
+    }
+
+    return errors[0];
+}
+
+Expression CompiledExpression::execute(const Float * values, UInt limit,
+    const ErrorContent & error) const {
+    const Bytecode & bytecode = program->bytecode;
+
+    Float value = 0;
+    UInt position;
+
+    const NativeCode * nativeCode = limit == bytecode.getInstructionCount() ?
+        program->promote() : EXPRESSIO_NULL;
+
+    if (nativeCode != EXPRESSIO_NULL) {
+        if (!nativeCode->run(values, value, position))
+            return Expression(Result(), ErrorContent(ErrorContent::DivisionByZero, position));
+    }
+    else {
+        UInt count = bytecode.getRegisterCount();
+
+        Float registerFile[EXPRESSIO_REGISTER_FILE_SIZE];
+        std::vector<Float> heapRegisters;
+        Float * registers = registerFile;
+
+        if (count > EXPRESSIO_REGISTER_FILE_SIZE) {
+            heapRegisters.resize(count);
+            registers = heapRegisters.data();
+        }
+
+        if (!bytecode.run(values, registers, limit, value, position))
+            return Expression(Result(), ErrorContent(ErrorContent::DivisionByZero, position));
+    }
+
+    if (error.type != ErrorContent::None)
+        return Expression(Result(), error);
+
+    return output(value);
+}
+Expression CompiledExpression::walk(const VariableTable & bindings) const {
+    const SyntaxTree & tree = program->tree;
+    std::vector<Float> values(tree.getSize());
+
+    for (Index i = 0; i <= tree.getRoot(); i++) {
+        const SyntaxTree::Node & node = tree.getNode(i);
+
+        if (node.type == Symbol::Variable) {
+            UInt slot;
+
+            if (!bindings.find(tree.getName(node.name), slot) || !bindings.isDefined(slot))
+                return Expression(Result(),
+                    ErrorContent(ErrorContent::UndefinedVariable, node.position));
+
+            values[i] = bindings.getValue(slot);
+        }
+        else if (node.type == Symbol::Number)
+            values[i] = node.value;
+        else {
+            Float rhs = values[node.right];
+
+            if (node.type == Symbol::Division && rhs == 0)
+                return Expression(Result(),
+                    ErrorContent(ErrorContent::DivisionByZero, node.position + 1));
+
+            values[i] = SyntaxTree::compute(node.type, values[node.left], rhs);
+        }
+    }
+
+    return output(values[tree.getRoot()]);
+}
+Expression CompiledExpression::output(Float value) const {
+    if (!program->isDefinition)
+        return Expression(Result("", value));
+
+    Result output(program->target, value, program->targetPosition);
+    output.isOutput = true;
+
+    return Expression(output);
+}
+
+Interpreter::Statistics::Statistics() : runs(0), compilations(0), tokens(0), nodes(0),
+    allocations(0), workspaceGrowths(0), workspaceBytes(0), tokenizeTime(0), parseTime(0),
+    optimizeTime(0), cacheTime(0), evaluateTime(0), lookupTime(0) {
+    std::fill(latencies, latencies + EXPRESSIO_LATENCY_BUCKET_COUNT, 0);
+}
+Interpreter::Statistics::~Statistics() {}
+
+UInt Interpreter::Statistics::getSampleCount() const {
+    UInt samples = 0;
+
+    for (UInt i = 0; i < EXPRESSIO_LATENCY_BUCKET_COUNT; i++)
+        samples += latencies[i];
+
+    return samples;
+}
+UInt Interpreter::Statistics::getLatency(Float percentile) const {
+    UInt samples = getSampleCount();
+
+    if (samples == 0)
+        return 0;
+
+    UInt rank = (UInt)std::ceil(percentile * samples);
+    UInt count = 0;
+
+    if (rank == 0)
+        rank = 1;
+
+    for (UInt i = 0; i < EXPRESSIO_LATENCY_BUCKET_COUNT; i++) {
+        count += latencies[i];
+
+        if (count >= rank)
+            return getBucketValue(i);
+    }
+
+    return getBucketValue(EXPRESSIO_LATENCY_BUCKET_COUNT - 1);
+}
+Interpreter::Statistics & Interpreter::Statistics::record(UInt latency) {
+    latencies[getBucket(latency)]++;
+
+    return *this;
+}
+Interpreter::Statistics & Interpreter::Statistics::merge(const Statistics & statistics) {
+    runs += statistics.runs;
+    compilations += statistics.compilations;
+    tokens += statistics.tokens;
+    nodes += statistics.nodes;
+    allocations += statistics.allocations;
+    workspaceGrowths += statistics.workspaceGrowths;
+    workspaceBytes = std::max(workspaceBytes, statistics.workspaceBytes);
+    tokenizeTime += statistics.tokenizeTime;
+    parseTime += statistics.parseTime;
+    optimizeTime += statistics.optimizeTime;
+    cacheTime += statistics.cacheTime;
+    evaluateTime += statistics.evaluateTime;
+    lookupTime += statistics.lookupTime;
+
+    for (UInt i = 0; i < EXPRESSIO_LATENCY_BUCKET_COUNT; i++)
+        latencies[i] += statistics.latencies[i];
+
+    return *this;
+}
+
+UInt Interpreter::Statistics::getBucket(UInt value) {
+    if (value < 8)
+        return value;
+
+    UInt exponent = 3;
+
+    while ((value >> (exponent + 1)) != 0)
+        exponent++;
+
+    return (exponent - 2) * 8 + ((value >> (exponent - 3)) & 7);
+}
+UInt Interpreter::Statistics::getBucketValue(UInt bucket) {
+    if (bucket < 8)
+        return bucket;
+
+    return (8 + bucket % 8) << (bucket / 8 - 1);
+}
+
+Interpreter::Stopwatch::Stopwatch(UInt scale) : scale(scale) {
+    if (scale != 0)
+        start = time = Clock::now();
+}
+Interpreter::Stopwatch::~Stopwatch() {}
+
+Bool Interpreter::Stopwatch::isEnabled() const {
+    return scale != 0;
+}
+UInt Interpreter::Stopwatch::getElapsed() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time - start).count();
+}
+UInt Interpreter::Stopwatch::lap() {
+    if (scale == 0)
+        return 0;
+
+    Clock::time_point now = Clock::now();
+    UInt nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(now - time).count();
+
+    time = now;
+
+    return nanoseconds * scale;
+}
+
+Interpreter::Interpreter() : decimalSeparator('.'), tracer(EXPRESSIO_NULL),
+    backend(CompiledExpression::VirtualMachine), optimization(true),
+    sharing(false), nativeThreshold(EXPRESSIO_NATIVE_THRESHOLD), depthLimit(0),
+    reactive(false), seed(0x9E3779B97F4A7C15ULL) {}
+Interpreter::~Interpreter() {}
+
+Expression Interpreter::run(const std::string & source) {
+    return run(source.data(), source.length());
+}
+Expression Interpreter::run(const Character * source, UInt length) {
+    Tracer::Scope scope(tracer, "run", "interpreter");
+    Stopwatch stopwatch(sample());
+
+    if (cache.getBudget() == 0) {
+        if (reactive) {
+            CompiledExpression compiledExpression = compile(source, length);
+            stopwatch.lap();
+
+            return execute(compiledExpression, stopwatch);
+        }
+
+        if (!workspace) {
+            workspace.reset(new CompiledExpression::Program);
+            statistics.allocations++;
+        }
+
+        compile(source, length, workspace->clear());
+
+        UInt workspaceBytes = CompiledExpression(workspace).getMemoryUsage();
+
+        if (workspaceBytes > statistics.workspaceBytes) {
+            statistics.workspaceBytes = workspaceBytes;
+            statistics.workspaceGrowths++;
+        }
+
+        stopwatch.lap();
+
+        return execute(CompiledExpression(workspace), stopwatch);
+    }
+
+    key.assign(1, decimalSeparator);
+    key.append(source, length);
+
+    CompiledExpression * cachedExpression = cache.find(key);
+
+    statistics.cacheTime += stopwatch.lap();
+
+    if (cachedExpression != EXPRESSIO_NULL)
+        return execute(*cachedExpression, stopwatch);
+
+    CompiledExpression compiledExpression = compile(source, length);
+    stopwatch.lap();
+
+    cache.insert(key, compiledExpression, compiledExpression.getMemoryUsage());
+    statistics.cacheTime += stopwatch.lap();
+
+    return execute(compiledExpression, stopwatch);
+}
+Expression Interpreter::run(const CompiledExpression & compiledExpression) {
+    Tracer::Scope scope(tracer, "run", "interpreter");
+    Stopwatch stopwatch(sample());
+
+    return execute(compiledExpression, stopwatch);
+}
+Expression Interpreter::evaluate(const Character * source, UInt length,
+    Statistics * statistics) const {
+    Stopwatch stopwatch(statistics != EXPRESSIO_NULL ? 1 : 0);
+    CompiledExpression compiledExpression;
+    thread_local std::string cacheKey;
+
+    cacheKey.assign(1, decimalSeparator);
+    cacheKey.append(source, length);
+
+    if (cache.getBudget() != 0) {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        CompiledExpression * cachedExpression = cache.find(cacheKey);
+
+        if (cachedExpression != EXPRESSIO_NULL)
+            compiledExpression = *cachedExpression;
+    }
+
+    if (statistics != EXPRESSIO_NULL)
+        statistics->cacheTime += stopwatch.lap();
+
+    if (!compiledExpression.program) {
+        std::shared_ptr<CompiledExpression::Program> program(
+            new CompiledExpression::Program);
+
+        build(source, length, *program, statistics);
+        resolve(*program);
+        stopwatch.lap();
+
+        compiledExpression = CompiledExpression(program);
+
+        if (cache.getBudget() != 0) {
+            std::lock_guard<std::mutex> lock(cacheMutex);
+            cache.insert(cacheKey, compiledExpression, compiledExpression.getMemoryUsage());
+        }
+
+        if (statistics != EXPRESSIO_NULL) {
+            statistics->allocations++;
+            statistics->cacheTime += stopwatch.lap();
+        }
+    }
+
+    Expression expression = evaluate(compiledExpression);
+
+    if (statistics != EXPRESSIO_NULL) {
+        statistics->runs++;
+        statistics->evaluateTime += stopwatch.lap();
+        statistics->record(stopwatch.getElapsed());
+    }
+
+    return expression;
+}
+CompiledExpression Interpreter::compile(const std::string & source) {
+    return compile(source.data(), source.length());
+}
+CompiledExpression Interpreter::compile(const Character * source, UInt length) {
+    std::shared_ptr<CompiledExpression::Program> program(
+        new CompiledExpression::Program);
+
+    statistics.allocations++;
+    compile(source, length, *program);
+
+    return CompiledExpression(program);
+}
+Interpreter & Interpreter::setDecimalSeparator(Character decimalSeparator) {
+    this->decimalSeparator = decimalSeparator;
+
+    return *this;
+}
+Interpreter & Interpreter::setTracer(Tracer * tracer) {
+    this->tracer = tracer;
+
+    return *this;
+}
+Interpreter & Interpreter::setBackend(CompiledExpression::Backend backend) {
+    this->backend = backend;
+
+    return *this;
+}
+Interpreter & Interpreter::setOptimization(Bool optimization) {
+    this->optimization = optimization;
+    cache.clear();
+
+    return *this;
+}
+Interpreter & Interpreter::setSubexpressionSharing(Bool sharing) {
+    this->sharing = sharing;
+    cache.clear();
+
+    return *this;
+}
+Interpreter & Interpreter::setNativeThreshold(UInt nativeThreshold) {
+    this->nativeThreshold = nativeThreshold;
+    cache.clear();
+
+    return *this;
+}
+Interpreter & Interpreter::setCacheBudget(UInt budget) {
+    cache.setBudget(budget);
+
+    return *this;
+}
+Interpreter & Interpreter::setDepthLimit(UInt depthLimit) {
+    this->depthLimit = depthLimit;
+    cache.clear();
+
+    return *this;
+}
+Interpreter & Interpreter::setReactive(Bool reactive) {
+    this->reactive = reactive;
+
+    dependencyGraph.clear();
+    definitions.clear();
+    recomputed.clear();
+
+    return *this;
+}
+Interpreter & Interpreter::setVariable(const std::string & name, Float value) {
+    UInt slot = variableTable.intern(name);
+
+    variableTable.setValue(slot, value);
+
+    if (reactive)
+        propagate(CompiledExpression(), slot);
+
+    return *this;
+}
+const VariableTable & Interpreter::getVariableTable() const {
+    return variableTable;
+}
+const DependencyGraph & Interpreter::getDependencyGraph() const {
+    return dependencyGraph;
+}
+std::vector<std::string> Interpreter::getRecomputedVariables() const {
+    std::vector<std::string> names;
+
+    for (UInt i = 0; i < recomputed.size(); i++)
+        names.push_back(variableTable.getName(recomputed[i]));
+
+    return names;
+}
+LRUCache<CompiledExpression>::Statistics Interpreter::getCacheStatistics() const {
+    return cache.getStatistics();
+}
+UInt Interpreter::sample() {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+
+    return seed % EXPRESSIO_STATISTICS_SAMPLE_RATE == 0 ? EXPRESSIO_STATISTICS_SAMPLE_RATE : 0;
+}
+const Interpreter::Statistics & Interpreter::getStatistics() const {
+    return statistics;
+}
+Interpreter & Interpreter::mergeStatistics(const Statistics & statistics) {
+    this->statistics.merge(statistics);
+
+    return *this;
+}
+Interpreter & Interpreter::resetStatistics() {
+    statistics = Statistics();
+
+    return *this;
+}
+Interpreter & Interpreter::clear() {
+    variableTable.clear();
+
+    dependencyGraph.clear();
+    definitions.clear();
+    recomputed.clear();
+
+    return *this;
+}
+
+void Interpreter::compile(const Character * source, UInt length,
+    CompiledExpression::Program & program) {
+    build(source, length, program, &statistics);
+
+    if (program.error.type != ErrorContent::None)
+        return;
+
+    Stopwatch stopwatch;
+
+    if (program.isDefinition)
+        program.targetSlot = variableTable.intern(program.target);
+
+    program.table = variableTable.getIdentity();
+
+    for (UInt i = 0; i < program.bytecode.getParameterCount(); i++)
+        program.slots.push_back(variableTable.intern(program.bytecode.getParameter(i).name));
+
+    statistics.lookupTime += stopwatch.lap();
+}
+void Interpreter::build(const Character * source, UInt length,
+    CompiledExpression::Program & program, Statistics * statistics) const {
+    Stopwatch stopwatch(statistics != EXPRESSIO_NULL ? 1 : 0);
+
+    {
+        Tracer::Scope scope(tracer, "tokenize", "compile");
+        program.error = tokenize(source, length, program.tokens, program.tree);
+    }
+
+    if (statistics != EXPRESSIO_NULL) {
+        statistics->compilations++;
+        statistics->tokens += program.tokens.getSize();
+        statistics->tokenizeTime += stopwatch.lap();
+    }
+
+    if (program.error.type == ErrorContent::None) {
+        Tracer::Scope scope(tracer, "parse", "compile");
+        program.error = parse(program.tokens, program.tree, program.operands,
+            program.operators);
+    }
+
+    if (statistics != EXPRESSIO_NULL) {
+        statistics->nodes += program.tree.getSize();
+        statistics->parseTime += stopwatch.lap();
+    }
+
+    if (program.error.type != ErrorContent::None)
+        return;
+
+    SyntaxTree & tree = program.tree;
+    const SyntaxTree::Node & root = tree.getNode(tree.getRoot());
+
+    if (root.type == Symbol::Assignment) {
+        program.isDefinition = true;
+        program.target = tree.getName(tree.getNode(root.left).name);
+        program.targetPosition = root.position;
+
+        tree.setRoot(root.right).compact();
+    }
+
+    Tracer::Scope scope(tracer, "optimize", "compile");
+
+    if (optimization) {
+        program.optimizer.optimize(tree);
+        program.removedNodeCount = program.optimizer.getRemovedCount();
+    }
+
+    if (sharing) {
+        program.optimizer.share(tree);
+        program.sharedNodeCount = program.optimizer.getSharedCount();
+    }
+
+    program.bytecode.lower(tree);
+    program.nativeThreshold = NativeCode::isEnabled() ? nativeThreshold : 0;
+
+    if (statistics != EXPRESSIO_NULL)
+        statistics->optimizeTime += stopwatch.lap();
+}
+Expression Interpreter::evaluate(const CompiledExpression & compiledExpression) const {
+    Tracer::Scope scope(tracer, "evaluate", "interpreter");
+
+    return compiledExpression.evaluate(variableTable, backend);
+}
+Expression Interpreter::execute(const CompiledExpression & compiledExpression,
+    Stopwatch & stopwatch) {
+    Expression expression = evaluate(compiledExpression);
+
+    recomputed.clear();
+    statistics.runs++;
+    statistics.evaluateTime += stopwatch.lap();
+
+    if (expression.error.type == ErrorContent::None && expression.output.isOutput) {
+        const CompiledExpression::Program * program = compiledExpression.program.get();
+        UInt slot = program->table == variableTable.getIdentity() ? program->targetSlot :
+            variableTable.intern(expression.output.name);
+
+        variableTable.setValue(slot, expression.output.value);
+
+        if (reactive)
+            propagate(compiledExpression, slot);
+
+        statistics.lookupTime += stopwatch.lap();
+    }
+    else if (reactive && compiledExpression.isValid() && compiledExpression.program->isDefinition) {
+        const CompiledExpression::Program * program = compiledExpression.program.get();
+        UInt slot = program->table == variableTable.getIdentity() ? program->targetSlot :
+            variableTable.intern(program->target);
+
+        variableTable.remove(slot);
+        propagate(compiledExpression, slot);
+    }
+
+    if (stopwatch.isEnabled())
+        statistics.record(stopwatch.getElapsed());
+
+    return expression;
+}
+void Interpreter::propagate(const CompiledExpression & compiledExpression, UInt target) {
+    const CompiledExpression::Program * program = compiledExpression.program.get();
+    std::vector<UInt> dependencies;
+
+    for (UInt i = 0; program != EXPRESSIO_NULL && i < program->bytecode.getParameterCount(); i++)
+        dependencies.push_back(program->table == variableTable.getIdentity() ? program->slots[i] :
+            variableTable.intern(program->bytecode.getParameter(i).name));
+
+    if (definitions.size() < variableTable.getSlotCount())
+        definitions.resize(variableTable.getSlotCount());
+
+    if (dependencyGraph.define(target, dependencies) && program != EXPRESSIO_NULL)
+        definitions[target] = compiledExpression;
+    else
+        definitions[target] = CompiledExpression();
+
+    dependencyGraph.sort(target, recomputed);
+
+    for (UInt i = 0; i < recomputed.size(); i++) {
+        UInt slot = recomputed[i];
+        Expression expression = definitions[slot].evaluate(variableTable, backend);
+
+        if (expression.error.type == ErrorContent::None)
+            variableTable.setValue(slot, expression.output.value);
+        else
+            variableTable.remove(slot);
+    }
+}
+void Interpreter::resolve(CompiledExpression::Program & program) const {
+    if (program.error.type != ErrorContent::None || program.isDefinition)
+        return;
+
+    for (UInt i = 0; i < program.bytecode.getParameterCount(); i++) {
+        UInt slot;
+
+        if (!variableTable.find(program.bytecode.getParameter(i).name, slot)) {
+            program.slots.clear();
+
+            return;
+        }
+
+        program.slots.push_back(slot);
+    }
+
+    program.table = variableTable.getIdentity();
+}
+ErrorContent Interpreter::tokenize(const Character * source, UInt length,
+    TokenStream & tokens, SyntaxTree & tree) const {
+    UInt i;
+
+    for (i = 0; i < length; i++) {
+        Character c = source[i];
+
+        if (c < -1 || c > 255)
+            return ErrorContent(ErrorContent::UnknownSymbol, i);
+
+        if (std::isspace(c))
+            continue;
+
+        UInt s;
+
+        if (isVariable(source, length, i, s)) {
+            Token token(Symbol::Variable, i);
+            token.name = tree.intern(std::string(source + i, s));
+
+            tokens.insert(token);
+            i += s - 1;
+        }
+        else if (isNumber(source, length, i, s)) {
+            Token token(Symbol::Number, i);
+            token.value = toNumber(source, i, s);
+
+            tokens.insert(token);
+            i += s - 1;
+        }
+        else {
+            switch (c) {
+            case '+':
+                tokens.insert(Token(Symbol::Addition, i));
+                break;
+            case '-':
+                tokens.insert(Token(Symbol::Subtraction, i));
+                break;
+            case '*':
+                tokens.insert(Token(Symbol::Multiplication, i));
+                break;
+            case '/':
+                tokens.insert(Token(Symbol::Division, i));
+                break;
+            case '^':
+                tokens.insert(Token(Symbol::Exponentiation, i));
+                break;
+            case '%':
+                tokens.insert(Token(Symbol::Modulo, i));
+                break;
+            case '=':
+                tokens.insert(Token(Symbol::Assignment, i));
+                break;
+            case '(':
+                tokens.insert(Token(Symbol::LParenthesis, i));
+                break;
+            case ')':
+                tokens.insert(Token(Symbol::RParenthesis, i));
+                break;
+            default:
+                return ErrorContent(ErrorContent::UnknownSymbol, i);
+            }
+        }
+    }
+
+    tokens.insert(Token(Symbol::EndOfFile, i));
+
+    return ErrorContent(ErrorContent::None);
+}
+ErrorContent Interpreter::parse(const TokenStream & tokens, SyntaxTree & tree,
+    std::vector<Index> & operands, std::vector<Token> & operators) const {
+    TokenStream::ConstIterator token(tokens.getBegin());
+    Symbol::Type first = token->type;
+    ErrorContent error;
+
+    Index root = expression(token, tree, operands, operators, error);
+
+    if (error.type != ErrorContent::None)
+        return error;
+
+    if (token->type == Symbol::Assignment && first == Symbol::Variable
+        && tree.getSize() == 1) {
+        Index position = (token++)->position;
+        Index value = expression(token, tree, operands, operators, error);
+
+        if (error.type != ErrorContent::None)
+            return error;
+
+        tree.addOperator(Symbol::Assignment, position, root, value);
+    }
+
+    if (token->type != Symbol::EndOfFile)
+        error = ErrorContent(ErrorContent::InvalidExpression, token->position);
+
+    return error;
+}
+Bool Interpreter::isVariable(const Character * source, UInt length, UInt offset,
+    UInt & size) const {
+    const Character * begin = source + offset;
+    const Character * end = source + length;
+    const Character * c = begin;
+
+    if (!std::isalpha(*c))
+        return false;
+
+    while (c != end && std::isalpha(*c))
+        c++;
+
+    size = c - begin;
+
+    return true;
+}
+Bool Interpreter::isNumber(const Character * source, UInt length, UInt offset,
+    UInt & size) const {
+    const Character * begin = source + offset;
+    const Character * end = source + length;
+    const Character * c = begin;
+
+    if (!std::isdigit(*c))
+        return false;
+
+    while (c != end && std::isdigit(*c))
+        c++;
+
+    if (c != end && *c == decimalSeparator) {
+        if (++c == end)
+            return false;
+
+        if (!std::isdigit(*c))
+            return false;
+
+        while (c != end && std::isdigit(*c))
+            c++;
+    }
+
+    if (c != end && *c == 'e') {
+        if (++c == end)
+            return false;
+
+        if (*c == '+' || *c == '-') {
+            if (++c == end)
+                return false;
+        }
+
+        if (!std::isdigit(*c))
+            return false;
+
+        while (c != end && std::isdigit(*c))
+            c++;
+    }
+
+    size = c - begin;
+
+    return true;
+}
+Float Interpreter::toNumber(const Character * source, UInt offset, UInt size) const {
+    Character buffer[EXPRESSIO_MAX_NUMBER_LENGTH + 1];
+    std::string heapBuffer;
+    Character * number = buffer;
+
+    if (size > EXPRESSIO_MAX_NUMBER_LENGTH) {
+        heapBuffer.resize(size + 1);
+        number = &heapBuffer[0];
+    }
+
+    Character decimalPoint = *std::localeconv()->decimal_point;
+
+    for (UInt i = 0; i < size; i++) {
+        Character c = source[offset + i];
+        number[i] = c == decimalSeparator ? decimalPoint : c;
+    }
+
+    number[size] = '\0';
+
+    return std::strtod(number, EXPRESSIO_NULL);
+}
+Index Interpreter::expression(TokenStream::ConstIterator & token, SyntaxTree & tree,
+    std::vector<Index> & operands, std::vector<Token> & operators, ErrorContent & error) const {
+    UInt depth = 0;
+
+    operands.clear();
+    operators.clear();
+
+    for (;;) {
+        while (token->type == Symbol::LParenthesis) {
+            if (depthLimit != 0 && depth == depthLimit) {
+                error = ErrorContent(ErrorContent::DepthLimitExceeded, token->position);
+
+                return 0;
+            }
+
+            operators.push_back(*token++);
+            depth++;
+        }
+
+        if (token->type == Symbol::Variable)
+            operands.push_back(tree.addVariable(token->name, token->position));
+        else if (token->type == Symbol::Number)
+            operands.push_back(tree.addNumber(token->value, token->position));
+        else {
+            error = ErrorContent(ErrorContent::InvalidExpression, token->position);
+
+            return 0;
+        }
+
+        token++;
+
+        for (;;) {
+            UInt level = precedence(*token);
+
+            if (level != 0) {
+                while (!operators.empty() && precedence(operators.back()) >= level)
+                    reduce(operands, operators, tree);
+
+                operators.push_back(*token++);
+
+                break;
+            }
+
+            if (token->type != Symbol::RParenthesis || depth == 0) {
+                if (depth != 0) {
+                    error = ErrorContent(ErrorContent::InvalidExpression, token->position);
+
+                    return 0;
+                }
+
+                while (!operators.empty())
+                    reduce(operands, operators, tree);
+
+                return operands.back();
+            }
+
+            while (operators.back().type != Symbol::LParenthesis)
+                reduce(operands, operators, tree);
+
+            operators.pop_back();
+            depth--;
+            token++;
+        }
+    }
+}
+
+void Interpreter::reduce(std::vector<Index> & operands, std::vector<Token> & operators,
+    SyntaxTree & tree) {
+    const Token & symbol = operators.back();
+    Index rhs = operands.back();
+
+    operands.pop_back();
+    operands.back() = tree.addOperator(symbol.type, symbol.position, operands.back(), rhs);
+    operators.pop_back();
+}
+UInt Interpreter::precedence(const Token & token) {
+    switch (token.type) {
+    case Symbol::Addition:
+    case Symbol::Subtraction:
+        return 1;
+    case Symbol::Multiplication:
+    case Symbol::Division:
+    case Symbol::Modulo:
+        return 2;
+    case Symbol::Exponentiation:
+        return 3;
+    default:
+        return 0;
+    }
+}
+
 EXPRESSIO_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,251 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "kernel.h"
+#include <cmath>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define EXPRESSIO_KERNEL_X86
+#include <immintrin.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#define EXPRESSIO_KERNEL_AVX2
+#else
+#define EXPRESSIO_KERNEL_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+static Bool addScalar(const Float * lhs, const Float * rhs, Float * target, UInt count) {
+    for (UInt i = 0; i < count; i++)
+        target[i] = lhs[i] + rhs[i];
+
+    return true;
+}
+static Bool subtractScalar(const Float * lhs, const Float * rhs, Float * target, UInt count) {
+    for (UInt i = 0; i < count; i++)
+        target[i] = lhs[i] - rhs[i];
+
+    return true;
+}
+static Bool multiplyScalar(const Float * lhs, const Float * rhs, Float * target, UInt count) {
+    for (UInt i = 0; i < count; i++)
+        target[i] = lhs[i] * rhs[i];
+
+    return true;
+}
+static Bool divideScalar(const Float * lhs, const Float * rhs, Float * target, UInt count) {
+    Bool valid = true;
+
+    for (UInt i = 0; i < count; i++) {
+        valid &= rhs[i] != 0;
+        target[i] = lhs[i] / rhs[i];
+    }
+
+    return valid;
+}
+static Bool powerScalar(const Float * lhs, const Float * rhs, Float * target, UInt count) {
+    for (UInt i = 0; i < count; i++)
+        target[i] = std::pow(lhs[i], rhs[i]);
+
+    return true;
+}
+static Bool moduloScalar(const Float * lhs, const Float * rhs, Float * target, UInt count) {
+    for (UInt i = 0; i < count; i++)
+        target[i] = std::fmod(lhs[i], rhs[i]);
+
+    return true;
+}
+
+#ifdef EXPRESSIO_KERNEL_X86
+static Bool addSSE2(const Float * lhs, const Float * rhs, Float * target, UInt count) {
+    UInt i = 0;
+
+    for (; i + 2 <= count; i += 2)
+        _mm_storeu_pd(target + i, _mm_add_pd(_mm_loadu_pd(lhs + i), _mm_loadu_pd(rhs + i)));
+
+    return addScalar(lhs + i, rhs + i, target + i, count - i);
+}
+static Bool subtractSSE2(const Float * lhs, const Float * rhs, Float * target, UInt count) {
+    UInt i = 0;
+
+    for (; i + 2 <= count; i += 2)
+        _mm_storeu_pd(target + i, _mm_sub_pd(_mm_loadu_pd(lhs + i), _mm_loadu_pd(rhs + i)));
+
+    return subtractScalar(lhs + i, rhs + i, target + i, count - i);
+}
+static Bool multiplySSE2(const Float * lhs, const Float * rhs, Float * target, UInt count) {
+    UInt i = 0;
+
+    for (; i + 2 <= count; i += 2)
+        _mm_storeu_pd(target + i, _mm_mul_pd(_mm_loadu_pd(lhs + i), _mm_loadu_pd(rhs + i)));
+
+    return multiplyScalar(lhs + i, rhs + i, target + i, count - i);
+}
+static Bool divideSSE2(const Float * lhs, const Float * rhs, Float * target, UInt count) {
+    __m128d zero = _mm_setzero_pd();
+    __m128d zeros = zero;
+    UInt i = 0;
+
+    for (; i + 2 <= count; i += 2) {
+        __m128d divisor = _mm_loadu_pd(rhs + i);
+
+        zeros = _mm_or_pd(zeros, _mm_cmpeq_pd(divisor, zero));
+        _mm_storeu_pd(target + i, _mm_div_pd(_mm_loadu_pd(lhs + i), divisor));
+    }
+
+    Bool valid = _mm_movemask_pd(zeros) == 0;
+
+    return divideScalar(lhs + i, rhs + i, target + i, count - i) && valid;
+}
+
+static EXPRESSIO_KERNEL_AVX2 Bool addAVX2(const Float * lhs, const Float * rhs,
+    Float * target, UInt count) {
+    UInt i = 0;
+
+    for (; i + 4 <= count; i += 4)
+        _mm256_storeu_pd(target + i, _mm256_add_pd(_mm256_loadu_pd(lhs + i),
+            _mm256_loadu_pd(rhs + i)));
+
+    return addScalar(lhs + i, rhs + i, target + i, count - i);
+}
+static EXPRESSIO_KERNEL_AVX2 Bool subtractAVX2(const Float * lhs, const Float * rhs,
+    Float * target, UInt count) {
+    UInt i = 0;
+
+    for (; i + 4 <= count; i += 4)
+        _mm256_storeu_pd(target + i, _mm256_sub_pd(_mm256_loadu_pd(lhs + i),
+            _mm256_loadu_pd(rhs + i)));
+
+    return subtractScalar(lhs + i, rhs + i, target + i, count - i);
+}
+static EXPRESSIO_KERNEL_AVX2 Bool multiplyAVX2(const Float * lhs, const Float * rhs,
+    Float * target, UInt count) {
+    UInt i = 0;
+
+    for (; i + 4 <= count; i += 4)
+        _mm256_storeu_pd(target + i, _mm256_mul_pd(_mm256_loadu_pd(lhs + i),
+            _mm256_loadu_pd(rhs + i)));
+
+    return multiplyScalar(lhs + i, rhs + i, target + i, count - i);
+}
+static EXPRESSIO_KERNEL_AVX2 Bool divideAVX2(const Float * lhs, const Float * rhs,
+    Float * target, UInt count) {
+    __m256d zero = _mm256_setzero_pd();
+    __m256d zeros = zero;
+    UInt i = 0;
+
+    for (; i + 4 <= count; i += 4) {
+        __m256d divisor = _mm256_loadu_pd(rhs + i);
+
+        zeros = _mm256_or_pd(zeros, _mm256_cmp_pd(divisor, zero, _CMP_EQ_OQ));
+        _mm256_storeu_pd(target + i, _mm256_div_pd(_mm256_loadu_pd(lhs + i), divisor));
+    }
+
+    Bool valid = _mm256_movemask_pd(zeros) == 0;
+
+    return divideScalar(lhs + i, rhs + i, target + i, count - i) && valid;
+}
+#endif
+
+Kernel::Kernel() {
+    select(detect());
+}
+Kernel::Kernel(InstructionSet instructionSet) {
+    select(instructionSet < detect() ? instructionSet : detect());
+}
+Kernel::~Kernel() {}
+
+Kernel::InstructionSet Kernel::getInstructionSet() const {
+    return instructionSet;
+}
+Kernel::Function Kernel::getFunction(Bytecode::OpCode code) const {
+    return functions[code];
+}
+
+Kernel::InstructionSet Kernel::detect() {
+#ifdef EXPRESSIO_KERNEL_X86
+#ifdef _MSC_VER
+    static const InstructionSet instructionSet = []() {
+        int information[4];
+        __cpuid(information, 0);
+
+        if (information[0] < 7)
+            return SSE2;
+
+        __cpuid(information, 1);
+
+        Bool isOSXSAVE = (information[2] & (1 << 27)) != 0;
+        Bool isAVX = (information[2] & (1 << 28)) != 0;
+
+        if (!isOSXSAVE || !isAVX || (_xgetbv(0) & 6) != 6)
+            return SSE2;
+
+        __cpuidex(information, 7, 0);
+
+        return (information[1] & (1 << 5)) != 0 ? AVX2 : SSE2;
+    }();
+#else
+    static const InstructionSet instructionSet =
+        __builtin_cpu_supports("avx2") ? AVX2 : SSE2;
+#endif
+
+    return instructionSet;
+#else
+    return Scalar;
+#endif
+}
+
+void Kernel::select(InstructionSet instructionSet) {
+    this->instructionSet = instructionSet;
+
+    functions[Bytecode::Add] = addScalar;
+    functions[Bytecode::Subtract] = subtractScalar;
+    functions[Bytecode::Multiply] = multiplyScalar;
+    functions[Bytecode::Divide] = divideScalar;
+    functions[Bytecode::Power] = powerScalar;
+    functions[Bytecode::Modulo] = moduloScalar;
+
+#ifdef EXPRESSIO_KERNEL_X86
+    if (instructionSet == SSE2) {
+        functions[Bytecode::Add] = addSSE2;
+        functions[Bytecode::Subtract] = subtractSSE2;
+        functions[Bytecode::Multiply] = multiplySSE2;
+        functions[Bytecode::Divide] = divideSSE2;
+    }
+    else if (instructionSet == AVX2) {
+        functions[Bytecode::Add] = addAVX2;
+        functions[Bytecode::Subtract] = subtractAVX2;
+        functions[Bytecode::Multiply] = multiplyAVX2;
+        functions[Bytecode::Divide] = divideAVX2;
+    }
+#endif
+}
+
+EXPRESSIO_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,148 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "mapping.h"
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+MappedFile::MappedFile() : memory(EXPRESSIO_NULL), size(0), opened(false) {}
+MappedFile::~MappedFile() {
+    close();
+}
+
+Bool MappedFile::open(const std::string & filename) {
+    close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+        EXPRESSIO_NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, EXPRESSIO_NULL);
+
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER fileSize;
+
+    if (GetFileType(file) != FILE_TYPE_DISK || !GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+
+        return false;
+    }
+
+    size = fileSize.QuadPart;
+
+    if (size != 0) {
+        HANDLE mapping = CreateFileMappingA(file, EXPRESSIO_NULL, PAGE_READONLY, 0, 0,
+            EXPRESSIO_NULL);
+
+        if (mapping != EXPRESSIO_NULL) {
+            memory = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            CloseHandle(mapping);
+        }
+
+        if (memory == EXPRESSIO_NULL) {
+            CloseHandle(file);
+            size = 0;
+
+            return false;
+        }
+    }
+
+    CloseHandle(file);
+#else
+    int descriptor = ::open(filename.c_str(), O_RDONLY);
+
+    if (descriptor < 0)
+        return false;
+
+    struct stat status;
+
+    if (fstat(descriptor, &status) != 0 || !S_ISREG(status.st_mode)) {
+        ::close(descriptor);
+
+        return false;
+    }
+
+    size = status.st_size;
+
+    if (size != 0) {
+        memory = mmap(EXPRESSIO_NULL, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+
+        if (memory == MAP_FAILED) {
+            ::close(descriptor);
+            memory = EXPRESSIO_NULL;
+            size = 0;
+
+            return false;
+        }
+
+        madvise(memory, size, MADV_SEQUENTIAL);
+    }
+
+    ::close(descriptor);
+#endif
+
+    opened = true;
+
+    return true;
+}
+MappedFile & MappedFile::close() {
+    if (memory != EXPRESSIO_NULL) {
+#ifdef _WIN32
+        UnmapViewOfFile(memory);
+#else
+        munmap(memory, size);
+#endif
+    }
+
+    memory = EXPRESSIO_NULL;
+    size = 0;
+    opened = false;
+
+    return *this;
+}
+Bool MappedFile::isOpen() const {
+    return opened;
+}
+const Character * MappedFile::getData() const {
+    return (const Character *)memory;
+}
+UInt MappedFile::getSize() const {
+    return size;
+}
+
+EXPRESSIO_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,277 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "native.h"
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <initializer_list>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define EXPRESSIO_NATIVE_X86
+#endif
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#endif
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+#ifdef EXPRESSIO_NATIVE_X86
+#ifdef _WIN32
+static const UInt shadowSize = 32;
+static const Byte argumentRegisters[] = { 0xCB, 0xD4 };
+#else
+static const UInt shadowSize = 0;
+static const Byte argumentRegisters[] = { 0xFB, 0xF4 };
+#endif
+
+static void emit(std::vector<Byte> & code, std::initializer_list<Byte> bytes) {
+    code.insert(code.end(), bytes.begin(), bytes.end());
+}
+static void emit(std::vector<Byte> & code, UInt value, UInt size) {
+    for (UInt i = 0; i < size; i++)
+        code.push_back((Byte)(value >> (8 * i)));
+}
+static void emitExit(std::vector<Byte> & code, UInt frameSize) {
+    emit(code, { 0x48, 0x81, 0xC4 });
+    emit(code, frameSize, 4);
+    emit(code, { 0x41, 0x5C, 0x5B, 0xC3 });
+}
+static void emitLoad(std::vector<Byte> & code, Byte xmm, const Bytecode::Operand & operand,
+    std::vector<std::pair<UInt, UInt> > & fixups) {
+    emit(code, { 0xF2, 0x0F, 0x10 });
+
+    switch (operand.kind) {
+    case Bytecode::Operand::Register:
+        emit(code, { (Byte)(0x84 | xmm << 3), 0x24 });
+        emit(code, shadowSize + 8 * operand.index, 4);
+        break;
+    case Bytecode::Operand::Variable:
+        emit(code, { (Byte)(0x83 | xmm << 3) });
+        emit(code, 8 * operand.index, 4);
+        break;
+    case Bytecode::Operand::Constant:
+        emit(code, { (Byte)(0x05 | xmm << 3) });
+        fixups.push_back(std::make_pair(code.size(), operand.index));
+        emit(code, 0, 4);
+        break;
+    }
+}
+static void emitCall(std::vector<Byte> & code, Float (*function)(Float, Float)) {
+    emit(code, { 0x48, 0xB8 });
+    emit(code, (UInt)(uintptr_t)function, 8);
+    emit(code, { 0xFF, 0xD0 });
+}
+#endif
+
+NativeCode::NativeCode() : memory(EXPRESSIO_NULL), size(0), function(EXPRESSIO_NULL) {}
+NativeCode::~NativeCode() {
+    release();
+}
+
+Bool NativeCode::compile(const Bytecode & bytecode) {
+    release();
+
+#ifdef EXPRESSIO_NATIVE_X86
+    std::vector<Byte> code;
+    std::vector<std::pair<UInt, UInt> > fixups;
+
+    UInt frameSize = shadowSize + 8 * bytecode.getRegisterCount();
+
+    if (frameSize % 16 == 0)
+        frameSize += 8;
+
+    emit(code, { 0x53, 0x41, 0x54, 0x48, 0x81, 0xEC });
+    emit(code, frameSize, 4);
+    emit(code, { 0x48, 0x89, argumentRegisters[0], 0x49, 0x89, argumentRegisters[1] });
+
+    for (UInt i = 0; i < bytecode.getInstructionCount(); i++) {
+        const Bytecode::Instruction & instruction = bytecode.getInstruction(i);
+
+        emitLoad(code, 0, instruction.lhs, fixups);
+        emitLoad(code, 1, instruction.rhs, fixups);
+
+        switch (instruction.code) {
+        case Bytecode::Add:
+            emit(code, { 0xF2, 0x0F, 0x58, 0xC1 });
+            break;
+        case Bytecode::Subtract:
+            emit(code, { 0xF2, 0x0F, 0x5C, 0xC1 });
+            break;
+        case Bytecode::Multiply:
+            emit(code, { 0xF2, 0x0F, 0x59, 0xC1 });
+            break;
+        case Bytecode::Divide: {
+            std::vector<Byte> fault;
+
+            emit(fault, { 0x48, 0xB8 });
+            emit(fault, instruction.position + 1, 8);
+            emitExit(fault, frameSize);
+
+            emit(code, { 0x66, 0x0F, 0x57, 0xD2, 0x66, 0x0F, 0x2E, 0xCA });
+            emit(code, { 0x7A, (Byte)(fault.size() + 2), 0x75, (Byte)fault.size() });
+            code.insert(code.end(), fault.begin(), fault.end());
+            emit(code, { 0xF2, 0x0F, 0x5E, 0xC1 });
+            break;
+        }
+        case Bytecode::Power:
+            emitCall(code, std::pow);
+            break;
+        case Bytecode::Modulo:
+            emitCall(code, std::fmod);
+            break;
+        }
+
+        emit(code, { 0xF2, 0x0F, 0x11, 0x84, 0x24 });
+        emit(code, shadowSize + 8 * instruction.target, 4);
+    }
+
+    emitLoad(code, 0, bytecode.getResult(), fixups);
+    emit(code, { 0xF2, 0x41, 0x0F, 0x11, 0x04, 0x24, 0x31, 0xC0 });
+    emitExit(code, frameSize);
+
+    while (code.size() % sizeof(Float) != 0)
+        code.push_back(0xCC);
+
+    UInt constantOffset = code.size();
+
+    for (UInt i = 0; i < bytecode.getConstantCount(); i++) {
+        Float constant = bytecode.getConstant(i);
+        Byte bytes[sizeof(Float)];
+
+        std::memcpy(bytes, &constant, sizeof(Float));
+        code.insert(code.end(), bytes, bytes + sizeof(Float));
+    }
+
+    for (UInt i = 0; i < fixups.size(); i++) {
+        UInt position = fixups[i].first;
+        UInt displacement = constantOffset + 8 * fixups[i].second - (position + 4);
+
+        for (UInt j = 0; j < 4; j++)
+            code[position + j] = (Byte)(displacement >> (8 * j));
+    }
+
+    size = code.size();
+
+#ifdef _WIN32
+    memory = VirtualAlloc(EXPRESSIO_NULL, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+
+    if (memory == EXPRESSIO_NULL) {
+        size = 0;
+
+        return false;
+    }
+
+    std::memcpy(memory, code.data(), size);
+
+    DWORD protection;
+
+    if (!VirtualProtect(memory, size, PAGE_EXECUTE_READ, &protection)) {
+        release();
+
+        return false;
+    }
+
+    FlushInstructionCache(GetCurrentProcess(), memory, size);
+#else
+    memory = mmap(EXPRESSIO_NULL, size, PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (memory == MAP_FAILED) {
+        memory = EXPRESSIO_NULL;
+        size = 0;
+
+        return false;
+    }
+
+    std::memcpy(memory, code.data(), size);
+
+    if (mprotect(memory, size, PROT_READ | PROT_EXEC) != 0) {
+        release();
+
+        return false;
+    }
+#endif
+
+    function = (Function)memory;
+
+    return true;
+#else
+    return false;
+#endif
+}
+Bool NativeCode::isCompiled() const {
+    return function != EXPRESSIO_NULL;
+}
+UInt NativeCode::getSize() const {
+    return size;
+}
+Bool NativeCode::run(const Float * variables, Float & value, UInt & position) const {
+    UInt status = function(variables, &value);
+
+    if (status != 0) {
+        position = status;
+
+        return false;
+    }
+
+    return true;
+}
+
+Bool NativeCode::isEnabled() {
+#ifdef EXPRESSIO_NATIVE_X86
+    static const Bool enabled = []() {
+        const Character * variable = std::getenv("EXPRESSIO_JIT");
+
+        return variable == EXPRESSIO_NULL || std::strcmp(variable, "0") != 0;
+    }();
+
+    return enabled;
+#else
+    return false;
+#endif
+}
+
+void NativeCode::release() {
+    if (memory != EXPRESSIO_NULL) {
+#ifdef _WIN32
+        VirtualFree(memory, 0, MEM_RELEASE);
+#else
+        munmap(memory, size);
+#endif
+    }
+
+    memory = EXPRESSIO_NULL;
+    size = 0;
+    function = EXPRESSIO_NULL;
+}
+
+EXPRESSIO_NAMESPACE_END
\ No newline at end of file
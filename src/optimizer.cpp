@@ -0,0 +1,187 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "optimizer.h"
+#include <cmath>
+#include <cstring>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+Optimizer::Optimizer() : removedCount(0), sharedCount(0) {}
+Optimizer::~Optimizer() {}
+
+UInt Optimizer::getRemovedCount() const {
+    return removedCount;
+}
+UInt Optimizer::getSharedCount() const {
+    return sharedCount;
+}
+UInt Optimizer::getMemoryUsage() const {
+    return nodes.capacity() * sizeof(SyntaxTree::Node)
+        + (indices.capacity() + buckets.capacity()) * sizeof(Index);
+}
+Optimizer & Optimizer::optimize(SyntaxTree & tree) {
+    removedCount = 0;
+
+    if (tree.isEmpty())
+        return *this;
+
+    nodes.clear();
+    nodes.reserve(tree.getSize());
+    indices.assign(tree.getSize(), 0);
+
+    for (Index i = 0; i <= tree.getRoot(); i++)
+        indices[i] = simplify(tree.getNode(i));
+
+    tree.assign(nodes, indices[tree.getRoot()]).compact();
+
+    return *this;
+}
+
+Optimizer & Optimizer::share(SyntaxTree & tree) {
+    sharedCount = 0;
+
+    if (tree.isEmpty())
+        return *this;
+
+    UInt size = 16;
+
+    while (size < 2 * tree.getSize())
+        size *= 2;
+
+    nodes.clear();
+    nodes.reserve(tree.getSize());
+    indices.assign(tree.getSize(), 0);
+    buckets.assign(size, 0);
+
+    for (Index i = 0; i <= tree.getRoot(); i++) {
+        SyntaxTree::Node node = tree.getNode(i);
+
+        if (!node.isLeaf()) {
+            node.left = indices[node.left];
+            node.right = indices[node.right];
+        }
+
+        for (UInt j = hash(node) & (size - 1); ; j = (j + 1) & (size - 1)) {
+            if (buckets[j] == 0) {
+                nodes.push_back(node);
+                buckets[j] = nodes.size();
+                indices[i] = nodes.size() - 1;
+
+                break;
+            }
+
+            if (isEqual(nodes[buckets[j] - 1], node)) {
+                indices[i] = buckets[j] - 1;
+                sharedCount++;
+
+                break;
+            }
+        }
+    }
+
+    tree.assign(nodes, indices[tree.getRoot()]);
+
+    return *this;
+}
+
+Index Optimizer::simplify(SyntaxTree::Node node) {
+    if (!node.isLeaf()) {
+        node.left = indices[node.left];
+        node.right = indices[node.right];
+
+        const SyntaxTree::Node & lhs = nodes[node.left];
+        const SyntaxTree::Node & rhs = nodes[node.right];
+
+        if (lhs.type == Symbol::Number && rhs.type == Symbol::Number) {
+            if (node.type != Symbol::Division || rhs.value != 0) {
+                Float value = SyntaxTree::compute(node.type, lhs.value, rhs.value);
+
+                node = SyntaxTree::Node(Symbol::Number, node.position, 0, 0);
+                node.value = value;
+                removedCount += 2;
+            }
+        }
+        else {
+            Bool isIdentity = false;
+
+            switch (node.type) {
+            case Symbol::Addition:
+                isIdentity = rhs.isNumber(0) && std::signbit(rhs.value);
+                break;
+            case Symbol::Subtraction:
+                isIdentity = rhs.isNumber(0) && !std::signbit(rhs.value);
+                break;
+            case Symbol::Multiplication:
+                if (lhs.isNumber(1)) {
+                    removedCount += 2;
+
+                    return node.right;
+                }
+
+                isIdentity = rhs.isNumber(1);
+                break;
+            case Symbol::Division:
+            case Symbol::Exponentiation:
+                isIdentity = rhs.isNumber(1);
+                break;
+            default:
+                break;
+            }
+
+            if (isIdentity) {
+                removedCount += 2;
+
+                return node.left;
+            }
+        }
+    }
+
+    nodes.push_back(node);
+
+    return nodes.size() - 1;
+}
+
+UInt Optimizer::hash(const SyntaxTree::Node & node) {
+    UInt bits;
+
+    std::memcpy(&bits, &node.value, sizeof(bits));
+
+    UInt value = (UInt)node.type;
+
+    value = value * 0x9E3779B97F4A7C15ULL ^ node.left;
+    value = value * 0x9E3779B97F4A7C15ULL ^ node.right;
+    value = value * 0x9E3779B97F4A7C15ULL ^ bits;
+
+    return value ^ (value >> 29);
+}
+Bool Optimizer::isEqual(const SyntaxTree::Node & lhs, const SyntaxTree::Node & rhs) {
+    return lhs.type == rhs.type && lhs.left == rhs.left && lhs.right == rhs.right
+        && std::memcmp(&lhs.value, &rhs.value, sizeof(lhs.value)) == 0;
+}
+
+EXPRESSIO_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,161 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "pool.h"
+#include <algorithm>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+ThreadPool::Worker::Worker() {}
+ThreadPool::Worker::~Worker() {}
+
+ThreadPool::ThreadPool(UInt threadCount) : generation(0), stopping(false),
+    task(EXPRESSIO_NULL), remaining(0), steals(0) {
+    if (threadCount == 0)
+        threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+
+    for (UInt i = 0; i < threadCount; i++)
+        workers.push_back(std::unique_ptr<Worker>(new Worker));
+
+    for (UInt i = 0; i < threadCount; i++)
+        workers[i]->thread = std::thread(&ThreadPool::work, this, i);
+}
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+
+    started.notify_all();
+
+    for (UInt i = 0; i < workers.size(); i++)
+        workers[i]->thread.join();
+}
+
+UInt ThreadPool::getThreadCount() const {
+    return workers.size();
+}
+UInt ThreadPool::getStealCount() const {
+    return steals;
+}
+ThreadPool & ThreadPool::run(UInt chunkCount, const Task & task) {
+    if (chunkCount == 0)
+        return *this;
+
+    std::lock_guard<std::mutex> runLock(runMutex);
+
+    this->task = &task;
+    remaining = chunkCount;
+
+    UInt threadCount = workers.size();
+
+    for (UInt i = 0; i < threadCount; i++) {
+        std::lock_guard<std::mutex> lock(workers[i]->mutex);
+
+        for (UInt j = chunkCount * i / threadCount; j < chunkCount * (i + 1) / threadCount; j++)
+            workers[i]->chunks.push_back(j);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        generation++;
+    }
+
+    started.notify_all();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [this]() { return remaining == 0; });
+
+    return *this;
+}
+
+void ThreadPool::work(UInt index) {
+    UInt current = 0;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            started.wait(lock, [this, current]() {
+                return stopping || generation != current;
+            });
+
+            if (stopping)
+                return;
+
+            current = generation;
+        }
+
+        execute(index);
+    }
+}
+void ThreadPool::execute(UInt index) {
+    UInt chunk;
+
+    while (pop(index, chunk) || steal(index, chunk)) {
+        (*task)(chunk);
+
+        if (--remaining == 0) {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+            }
+
+            finished.notify_all();
+        }
+    }
+}
+Bool ThreadPool::pop(UInt index, UInt & chunk) {
+    Worker & worker = *workers[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+
+    if (worker.chunks.empty())
+        return false;
+
+    chunk = worker.chunks.front();
+    worker.chunks.pop_front();
+
+    return true;
+}
+Bool ThreadPool::steal(UInt index, UInt & chunk) {
+    for (UInt i = 1; i < workers.size(); i++) {
+        Worker & victim = *workers[(index + i) % workers.size()];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+
+        if (victim.chunks.empty())
+            continue;
+
+        chunk = victim.chunks.back();
+        victim.chunks.pop_back();
+
+        steals++;
+
+        return true;
+    }
+
+    return false;
+}
+
+EXPRESSIO_NAMESPACE_END
\ No newline at end of file
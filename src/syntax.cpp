@@ -0,0 +1,226 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "syntax.h"
+#include <cmath>
+#include <functional>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+SyntaxTree::Node::Node() : type(Symbol::Number), position(0), left(0), right(0), value(0) {}
+SyntaxTree::Node::Node(Symbol::Type type, Index position, Index left, Index right)
+    : type(type), position(position), left(left), right(right), value(0) {}
+SyntaxTree::Node::~Node() {}
+
+Bool SyntaxTree::Node::isLeaf() const {
+    return type == Symbol::Variable || type == Symbol::Number;
+}
+Bool SyntaxTree::Node::isNumber(Float value) const {
+    return type == Symbol::Number && this->value == value;
+}
+
+SyntaxTree::Bucket::Bucket() : generation(0), name(0) {}
+SyntaxTree::Bucket::~Bucket() {}
+
+SyntaxTree::SyntaxTree() : generation(1), root(0) {}
+SyntaxTree::~SyntaxTree() {}
+
+UInt SyntaxTree::getSize() const {
+    return nodes.size();
+}
+Index SyntaxTree::getRoot() const {
+    return root;
+}
+const SyntaxTree::Node & SyntaxTree::getNode(Index index) const {
+    return nodes[index];
+}
+SyntaxTree::Node & SyntaxTree::getNode(Index index) {
+    return nodes[index];
+}
+const std::vector<SyntaxTree::Node> & SyntaxTree::getNodes() const {
+    return nodes;
+}
+UInt SyntaxTree::getNameCount() const {
+    return names.size();
+}
+const std::string & SyntaxTree::getName(Index index) const {
+    return names[index];
+}
+UInt SyntaxTree::getMemoryUsage() const {
+    UInt size = nodes.capacity() * sizeof(Node) + names.capacity() * sizeof(std::string)
+        + buckets.capacity() * sizeof(Bucket) + indices.capacity() * sizeof(Index)
+        + reachable.capacity() / 8;
+
+    for (UInt i = 0; i < names.size(); i++)
+        size += names[i].capacity();
+
+    return size;
+}
+Bool SyntaxTree::isEmpty() const {
+    return nodes.empty();
+}
+
+Index SyntaxTree::addNumber(Float value, Index position) {
+    Node node(Symbol::Number, position, 0, 0);
+    node.value = value;
+
+    return add(node);
+}
+Index SyntaxTree::addVariable(const std::string & name, Index position) {
+    return addVariable(intern(name), position);
+}
+Index SyntaxTree::addVariable(Index name, Index position) {
+    Node node(Symbol::Variable, position, 0, 0);
+    node.name = name;
+
+    return add(node);
+}
+Index SyntaxTree::intern(const std::string & name) {
+    if (2 * (names.size() + 1) > buckets.size())
+        rehash(buckets.empty() ? 16 : 2 * buckets.size());
+
+    UInt mask = buckets.size() - 1;
+
+    for (UInt i = std::hash<std::string>()(name) & mask; ; i = (i + 1) & mask) {
+        Bucket & bucket = buckets[i];
+
+        if (bucket.generation != generation) {
+            bucket.generation = generation;
+            bucket.name = names.size();
+            names.push_back(name);
+
+            return bucket.name;
+        }
+
+        if (names[bucket.name] == name)
+            return bucket.name;
+    }
+}
+Index SyntaxTree::addOperator(Symbol::Type type, Index position, Index left, Index right) {
+    return add(Node(type, position, left, right));
+}
+Index SyntaxTree::add(const Node & node) {
+    nodes.push_back(node);
+    root = nodes.size() - 1;
+
+    return root;
+}
+SyntaxTree & SyntaxTree::setRoot(Index root) {
+    this->root = root;
+
+    return *this;
+}
+SyntaxTree & SyntaxTree::assign(std::vector<Node> & nodes, Index root) {
+    this->nodes.swap(nodes);
+    this->root = root;
+
+    return *this;
+}
+SyntaxTree & SyntaxTree::compact() {
+    if (nodes.empty())
+        return *this;
+
+    indices.assign(root + 1, 0);
+    reachable.assign(root + 1, false);
+
+    reachable[root] = true;
+
+    for (Index i = root + 1; i-- > 0;) {
+        if (reachable[i] && !nodes[i].isLeaf()) {
+            reachable[nodes[i].left] = true;
+            reachable[nodes[i].right] = true;
+        }
+    }
+
+    Index size = 0;
+
+    for (Index i = 0; i <= root; i++) {
+        if (!reachable[i])
+            continue;
+
+        Node node = nodes[i];
+
+        if (!node.isLeaf()) {
+            node.left = indices[node.left];
+            node.right = indices[node.right];
+        }
+
+        indices[i] = size;
+        nodes[size++] = node;
+    }
+
+    nodes.resize(size);
+    root = size - 1;
+
+    return *this;
+}
+SyntaxTree & SyntaxTree::clear() {
+    nodes.clear();
+    names.clear();
+    generation++;
+    root = 0;
+
+    return *this;
+}
+
+Float SyntaxTree::compute(Symbol::Type type, Float lhs, Float rhs) {
+    switch (type) {
+    case Symbol::Addition:
+        return lhs + rhs;
+    case Symbol::Subtraction:
+        return lhs - rhs;
+    case Symbol::Multiplication:
+        return lhs * rhs;
+    case Symbol::Division:
+        return lhs / rhs;
+    case Symbol::Exponentiation:
+        return std::pow(lhs, rhs);
+    case Symbol::Modulo:
+        return std::fmod(lhs, rhs);
+    default:
+        return rhs;
+    }
+}
+
+void SyntaxTree::rehash(UInt size) {
+    buckets.assign(size, Bucket());
+    generation = 1;
+
+    UInt mask = size - 1;
+
+    for (Index name = 0; name < names.size(); name++) {
+        UInt i = std::hash<std::string>()(names[name]) & mask;
+
+        while (buckets[i].generation == generation)
+            i = (i + 1) & mask;
+
+        buckets[i].generation = generation;
+        buckets[i].name = name;
+    }
+}
+
+EXPRESSIO_NAMESPACE_END
\ No newline at end of file
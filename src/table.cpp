@@ -0,0 +1,142 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "table.h"
+#include <atomic>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+VariableTable::VariableTable() : size(0), identity(createIdentity()) {}
+VariableTable::VariableTable(const VariableTable & variableTable)
+    : index(variableTable.index), names(variableTable.names), values(variableTable.values),
+    defined(variableTable.defined), size(variableTable.size), identity(createIdentity()) {}
+VariableTable::~VariableTable() {}
+
+VariableTable & VariableTable::operator =(const VariableTable & variableTable) {
+    if (this != &variableTable) {
+        index = variableTable.index;
+        names = variableTable.names;
+        values = variableTable.values;
+        defined = variableTable.defined;
+        size = variableTable.size;
+        identity = createIdentity();
+    }
+
+    return *this;
+}
+
+UInt VariableTable::getIdentity() const {
+    return identity;
+}
+UInt VariableTable::getSize() const {
+    return size;
+}
+UInt VariableTable::getSlotCount() const {
+    return names.size();
+}
+Bool VariableTable::isEmpty() const {
+    return size == 0;
+}
+Bool VariableTable::isDefined(UInt slot) const {
+    return defined[slot];
+}
+const std::string & VariableTable::getName(UInt slot) const {
+    return names[slot];
+}
+Float VariableTable::getValue(UInt slot) const {
+    return values[slot];
+}
+const Float * VariableTable::getValues() const {
+    return values.data();
+}
+Bool VariableTable::find(const std::string & name, UInt & slot) const {
+    std::unordered_map<std::string, UInt>::const_iterator it = index.find(name);
+
+    if (it == index.end())
+        return false;
+
+    slot = it->second;
+
+    return true;
+}
+
+UInt VariableTable::intern(const std::string & name) {
+    UInt slot;
+
+    if (find(name, slot))
+        return slot;
+
+    slot = names.size();
+    index.insert(std::make_pair(name, slot));
+
+    names.push_back(name);
+    values.push_back(0);
+    defined.push_back(false);
+
+    return slot;
+}
+VariableTable & VariableTable::insert(const std::string & name, Float value) {
+    return setValue(intern(name), value);
+}
+VariableTable & VariableTable::setValue(UInt slot, Float value) {
+    if (!defined[slot]) {
+        defined[slot] = true;
+        size++;
+    }
+
+    values[slot] = value;
+
+    return *this;
+}
+VariableTable & VariableTable::remove(UInt slot) {
+    if (defined[slot]) {
+        defined[slot] = false;
+        size--;
+    }
+
+    values[slot] = 0;
+
+    return *this;
+}
+VariableTable & VariableTable::clear() {
+    for (UInt i = 0; i < defined.size(); i++) {
+        defined[i] = false;
+        values[i] = 0;
+    }
+
+    size = 0;
+
+    return *this;
+}
+
+UInt VariableTable::createIdentity() {
+    static std::atomic<UInt> identityCount(0);
+
+    return ++identityCount;
+}
+
+EXPRESSIO_NAMESPACE_END
\ No newline at end of file
@@ -0,0 +1,165 @@
+// Copyright (c) 2017, Danilo Peixoto. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "trace.h"
+#include <cstdio>
+#include <fstream>
+
+EXPRESSIO_NAMESPACE_BEGIN
+
+static std::atomic<UInt> tracerCount(0);
+
+Tracer::Event::Event() : name(EXPRESSIO_NULL), category(EXPRESSIO_NULL), begin(0),
+    duration(0) {}
+Tracer::Event::Event(const Character * name, const Character * category, UInt begin,
+    UInt duration) : name(name), category(category), begin(begin), duration(duration) {}
+Tracer::Event::~Event() {}
+
+Tracer::Buffer::Buffer(UInt thread, std::thread::id owner, UInt capacity) : thread(thread),
+    owner(owner), next(EXPRESSIO_NULL) {
+    events.reserve(capacity);
+}
+Tracer::Buffer::~Buffer() {}
+
+Tracer::Tracer(UInt capacity) : id(++tracerCount), capacity(capacity),
+    origin(Clock::now()), buffers(EXPRESSIO_NULL), threadCount(0), dropped(0) {}
+Tracer::~Tracer() {
+    Buffer * buffer = buffers;
+
+    while (buffer != EXPRESSIO_NULL) {
+        Buffer * next = buffer->next;
+        delete buffer;
+        buffer = next;
+    }
+}
+
+UInt Tracer::now() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - origin).count();
+}
+UInt Tracer::getThreadCount() const {
+    return threadCount;
+}
+UInt Tracer::getEventCount() const {
+    UInt count = 0;
+
+    for (Buffer * buffer = buffers; buffer != EXPRESSIO_NULL; buffer = buffer->next)
+        count += buffer->events.size();
+
+    return count;
+}
+UInt Tracer::getDroppedCount() const {
+    return dropped;
+}
+Tracer & Tracer::record(const Character * name, const Character * category, UInt begin,
+    UInt end) {
+    Buffer * buffer = getBuffer();
+
+    if (buffer->events.size() < capacity)
+        buffer->events.push_back(Event(name, category, begin, end - begin));
+    else
+        dropped.fetch_add(1, std::memory_order_relaxed);
+
+    return *this;
+}
+Tracer & Tracer::clear() {
+    for (Buffer * buffer = buffers; buffer != EXPRESSIO_NULL; buffer = buffer->next)
+        buffer->events.clear();
+
+    dropped = 0;
+
+    return *this;
+}
+Bool Tracer::write(const std::string & filename) const {
+    std::ofstream file(filename.c_str());
+
+    if (!file.is_open())
+        return false;
+
+    Character line[256];
+    Bool first = true;
+
+    file << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+
+    for (Buffer * buffer = buffers; buffer != EXPRESSIO_NULL; buffer = buffer->next) {
+        std::snprintf(line, sizeof(line), "%s{\"name\":\"thread_name\",\"ph\":\"M\","
+            "\"pid\":1,\"tid\":%llu,\"args\":{\"name\":\"thread %llu\"}}", first ? "" : ",\n",
+            (unsigned long long)buffer->thread, (unsigned long long)buffer->thread);
+
+        file << line;
+        first = false;
+
+        for (UInt i = 0; i < buffer->events.size(); i++) {
+            const Event & event = buffer->events[i];
+
+            std::snprintf(line, sizeof(line), ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\","
+                "\"ts\":%llu.%03llu,\"dur\":%llu.%03llu,\"pid\":1,\"tid\":%llu}", event.name,
+                event.category, (unsigned long long)(event.begin / 1000),
+                (unsigned long long)(event.begin % 1000),
+                (unsigned long long)(event.duration / 1000),
+                (unsigned long long)(event.duration % 1000),
+                (unsigned long long)buffer->thread);
+
+            file << line;
+        }
+    }
+
+    std::snprintf(line, sizeof(line), "\n],\"otherData\":{\"dropped\":%llu}}\n",
+        (unsigned long long)getDroppedCount());
+
+    file << line;
+
+    return file.good();
+}
+
+Tracer::Buffer * Tracer::getBuffer() {
+    thread_local UInt owner = 0;
+    thread_local Buffer * buffer = EXPRESSIO_NULL;
+
+    if (owner == id)
+        return buffer;
+
+    std::thread::id thread = std::this_thread::get_id();
+
+    for (buffer = buffers; buffer != EXPRESSIO_NULL; buffer = buffer->next) {
+        if (buffer->owner == thread)
+            break;
+    }
+
+    if (buffer == EXPRESSIO_NULL) {
+        buffer = new Buffer(threadCount++, thread, capacity);
+        buffer->next = buffers.load();
+
+        while (!buffers.compare_exchange_weak(buffer->next, buffer));
+    }
+
+    owner = id;
+
+    return buffer;
+}
+
+EXPRESSIO_NAMESPACE_END
\ No newline at end of file